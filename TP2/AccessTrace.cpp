@@ -0,0 +1,202 @@
+#include "AccessTrace.hpp"
+#include "AddressTrace.hpp"
+#include <iostream>
+#include <fstream>
+#include <cstring>
+#include <cstdlib>
+#include <cctype>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+AccessTrace::~AccessTrace()
+{
+    clear();
+}
+
+AccessTrace::AccessTrace(AccessTrace &&other) noexcept
+{
+    *this = std::move(other);
+}
+
+AccessTrace &AccessTrace::operator=(AccessTrace &&other) noexcept
+{
+    if (this != &other)
+    {
+        clear();
+        storage = std::move(other.storage);
+        mapping = other.mapping;
+        mappingBytes = other.mappingBytes;
+        mappedData = other.mappedData;
+        mappedCount = other.mappedCount;
+        other.mapping = nullptr;
+        other.mappingBytes = other.mappedCount = 0;
+        other.mappedData = nullptr;
+    }
+    return *this;
+}
+
+void AccessTrace::push(int page, bool modified)
+{
+    if (mapping)
+    {
+        std::cerr << "Error: no se puede modificar una traza proyectada con mmap.\n";
+        std::exit(EXIT_FAILURE);
+    }
+    storage.push_back(packAccess(page, modified));
+}
+
+void AccessTrace::append(const PackedAccess *words, size_t count)
+{
+    if (mapping)
+    {
+        std::cerr << "Error: no se puede modificar una traza proyectada con mmap.\n";
+        std::exit(EXIT_FAILURE);
+    }
+    storage.insert(storage.end(), words, words + count);
+}
+
+void AccessTrace::clear()
+{
+    if (mapping)
+        munmap(mapping, mappingBytes);
+    mapping = nullptr;
+    mappingBytes = mappedCount = 0;
+    mappedData = nullptr;
+    storage.clear();
+}
+
+bool AccessTrace::save(const std::string &path) const
+{
+    std::ofstream out(path, std::ios::binary);
+    if (!out)
+        return false;
+
+    TraceFileHeader header;
+    std::memcpy(header.magic, TRACE_FILE_MAGIC, sizeof(header.magic));
+    header.version = TRACE_FILE_VERSION;
+    header.count = size();
+
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char *>(data()), size() * sizeof(PackedAccess));
+    return static_cast<bool>(out);
+}
+
+bool AccessTrace::map(const std::string &path)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(TraceFileHeader))
+    {
+        close(fd);
+        return false;
+    }
+
+    size_t bytes = static_cast<size_t>(info.st_size);
+    void *region = mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (region == MAP_FAILED)
+        return false;
+
+    const auto *header = static_cast<const TraceFileHeader *>(region);
+    if (std::memcmp(header->magic, TRACE_FILE_MAGIC, sizeof(header->magic)) != 0 ||
+        header->version != TRACE_FILE_VERSION ||
+        header->count > (bytes - sizeof(TraceFileHeader)) / sizeof(PackedAccess))
+    {
+        munmap(region, bytes);
+        return false;
+    }
+
+    // La traza se recorre una vez de principio a fin
+    madvise(region, bytes, MADV_SEQUENTIAL);
+
+    clear();
+    mapping = region;
+    mappingBytes = bytes;
+    mappedData = reinterpret_cast<const PackedAccess *>(static_cast<const char *>(region) + sizeof(TraceFileHeader));
+    mappedCount = header->count;
+    return true;
+}
+
+// Carga una traza desde archivo: binaria (vía mmap), de texto o de direcciones virtuales
+void loadAccessTrace(const std::string &path, AccessTrace &trace, int pageShift)
+{
+    if (trace.map(path))
+        return;
+
+    std::ifstream in(path);
+    if (!in)
+    {
+        std::cerr << "Error: no se pudo abrir el archivo de traza: " << path << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+
+    // El texto se parsea por bloques, sin cargar una copia completa del archivo; el
+    // primer bloque decide el formato
+    std::unique_ptr<TextTokenizer> tokenizer;
+    std::vector<char> block(TEXT_BLOCK_BYTES);
+    while (in.read(block.data(), block.size()) || in.gcount() > 0)
+    {
+        size_t got = static_cast<size_t>(in.gcount());
+        if (!tokenizer)
+            tokenizer = makeTextTokenizer(block.data(), got, pageShift);
+        tokenizer->feed(block.data(), got, trace);
+    }
+    if (tokenizer)
+        tokenizer->finish(trace);
+}
+
+std::unique_ptr<TextTokenizer> makeTextTokenizer(const char *head, size_t length, int pageShift)
+{
+    if (isAddressTrace(head, length))
+        return std::make_unique<AddressTokenizer>(pageShift);
+    return std::make_unique<AccessTokenizer>();
+}
+
+void AccessTokenizer::feed(const char *text, size_t length, AccessTrace &out)
+{
+    for (size_t i = 0; i < length; ++i)
+    {
+        char c = text[i];
+        if (c == ',')
+            emit(out);
+        else if (!std::isspace(static_cast<unsigned char>(c)) && c != '[' && c != ']')
+            token += c;
+    }
+}
+
+void AccessTokenizer::finish(AccessTrace &out)
+{
+    if (!token.empty())
+        emit(out);
+}
+
+// Convierte un token como "5" o "5*" en un acceso; termina el programa si es inválido
+void AccessTokenizer::emit(AccessTrace &out)
+{
+    bool modified = false;
+    if (!token.empty() && token.back() == '*')
+    {
+        modified = true;
+        token.pop_back();
+    }
+
+    try
+    {
+        int page = std::stoi(token);
+        if (page < MIN_TRACE_PAGE || page > MAX_TRACE_PAGE)
+            throw std::out_of_range(token);
+        out.push(page, modified);
+    }
+    catch (...)
+    {
+        std::cerr << "Error: entrada inválida en secuencia: " << token << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+    token.clear();
+}
@@ -0,0 +1,183 @@
+#ifndef ACCESS_TRACE_HPP
+#define ACCESS_TRACE_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Acceso empaquetado en una palabra de 32 bits: número de página (con signo) en los
+// bits 31..1 y el bit M (modificado, '*') en el bit 0.
+using PackedAccess = uint32_t;
+
+// Rango de páginas representable en un acceso empaquetado
+const int MIN_TRACE_PAGE = -(1 << 30);
+const int MAX_TRACE_PAGE = (1 << 30) - 1;
+
+inline PackedAccess packAccess(int page, bool modified)
+{
+    return (static_cast<uint32_t>(page) << 1) | (modified ? 1u : 0u);
+}
+
+inline int accessPage(PackedAccess access)
+{
+    return static_cast<int32_t>(access) >> 1;
+}
+
+inline bool accessModified(PackedAccess access)
+{
+    return (access & 1u) != 0;
+}
+
+// Cabecera del formato binario de trazas
+struct TraceFileHeader
+{
+    char magic[4];    // "TP2T"
+    uint32_t version; // TRACE_FILE_VERSION
+    uint64_t count;   // Cantidad de accesos empaquetados que siguen
+};
+
+const char TRACE_FILE_MAGIC[4] = {'T', 'P', '2', 'T'};
+const uint32_t TRACE_FILE_VERSION = 1;
+
+// Tamaño de los bloques en que se lee una traza de texto
+const size_t TEXT_BLOCK_BYTES = 64 * 1024;
+
+// Páginas de 4 KiB (2^12 bytes) al convertir direcciones virtuales en números de página
+const int DEFAULT_PAGE_SHIFT = 12;
+
+// Secuencia de accesos contigua: un solo arreglo de palabras empaquetadas, propio
+// (construido al parsear) o proyectado con mmap desde un archivo binario de traza.
+class AccessTrace
+{
+public:
+    AccessTrace() = default;
+    ~AccessTrace();
+
+    AccessTrace(const AccessTrace &) = delete;
+    AccessTrace &operator=(const AccessTrace &) = delete;
+    AccessTrace(AccessTrace &&other) noexcept;
+    AccessTrace &operator=(AccessTrace &&other) noexcept;
+
+    void push(int page, bool modified);
+    void append(const PackedAccess *words, size_t count);
+    void reserve(size_t count) { storage.reserve(count); }
+    void clear();
+
+    size_t size() const { return mapping ? mappedCount : storage.size(); }
+    bool empty() const { return size() == 0; }
+    const PackedAccess *data() const { return mapping ? mappedData : storage.data(); }
+    const PackedAccess *begin() const { return data(); }
+    const PackedAccess *end() const { return data() + size(); }
+    PackedAccess operator[](size_t i) const { return data()[i]; }
+
+    int page(size_t i) const { return accessPage(data()[i]); }
+    bool modified(size_t i) const { return accessModified(data()[i]); }
+
+    // Guarda la traza en formato binario (cabecera + palabras empaquetadas)
+    bool save(const std::string &path) const;
+
+    // Proyecta con mmap un archivo binario de traza; false si no tiene el formato
+    bool map(const std::string &path);
+
+private:
+    std::vector<PackedAccess> storage;
+    void *mapping = nullptr;                 // Región proyectada (nullptr si es propia)
+    size_t mappingBytes = 0;
+    const PackedAccess *mappedData = nullptr;
+    size_t mappedCount = 0;
+};
+
+// Carga una traza desde archivo: binaria (vía mmap), de texto como "[2,6,1*,8]" o de
+// direcciones virtuales, que se convierten en páginas de 2^pageShift bytes
+void loadAccessTrace(const std::string &path, AccessTrace &trace, int pageShift = DEFAULT_PAGE_SHIFT);
+
+// Parser incremental de una traza de texto: recibe el texto en pedazos arbitrarios (un
+// registro puede quedar partido entre dos) y agrega los accesos a la traza sin copiar la
+// entrada completa.
+class TextTokenizer
+{
+public:
+    virtual ~TextTokenizer() = default;
+
+    virtual void feed(const char *text, size_t length, AccessTrace &out) = 0;
+
+    // Cierra la entrada: agrega lo que haya quedado pendiente
+    virtual void finish(AccessTrace &out) = 0;
+};
+
+// Elige el parser según el comienzo del texto: direcciones o "[2,6,1*,8,...]"
+std::unique_ptr<TextTokenizer> makeTextTokenizer(const char *head, size_t length, int pageShift);
+
+// Parser del formato de texto "[2,6,1*,8,...]". Los espacios y corchetes se ignoran.
+class AccessTokenizer : public TextTokenizer
+{
+public:
+    void feed(const char *text, size_t length, AccessTrace &out) override;
+    void finish(AccessTrace &out) override;
+
+private:
+    void emit(AccessTrace &out);
+
+    std::string token;
+};
+
+// Proveedor de bloques consecutivos de accesos para recorrer una traza sin tenerla entera
+// en memoria. Cada bloque entregado es válido hasta el siguiente pedido.
+class ChunkSource
+{
+public:
+    virtual ~ChunkSource() = default;
+
+    // Entrega el próximo bloque en [begin, end); false cuando la traza terminó
+    virtual bool nextChunk(const PackedAccess *&begin, const PackedAccess *&end) = 0;
+};
+
+// Recorrido secuencial de accesos, sobre una traza en memoria o sobre los bloques de un
+// ChunkSource. El caso común (quedan accesos en el bloque actual) es una comparación y
+// una lectura; solo al agotar un bloque se pide el siguiente.
+class AccessCursor
+{
+public:
+    explicit AccessCursor(const AccessTrace &trace) : start(trace.begin()), pos(start), last(trace.end()) {}
+    explicit AccessCursor(ChunkSource &source) : source(&source) {}
+
+    bool next(PackedAccess &access)
+    {
+        if (pos == last && !refill())
+            return false;
+        access = *pos++;
+        return true;
+    }
+
+    // Accesos entregados hasta ahora
+    size_t consumed() const { return previous + (pos - start); }
+
+private:
+    bool refill()
+    {
+        while (source)
+        {
+            previous += last - start;
+            if (!source->nextChunk(start, last))
+            {
+                source = nullptr;
+                start = pos = last = nullptr;
+                return false;
+            }
+            pos = start;
+            if (pos != last)
+                return true;
+        }
+        return false;
+    }
+
+    ChunkSource *source = nullptr;
+    const PackedAccess *start = nullptr; // Inicio del bloque actual
+    const PackedAccess *pos = nullptr;
+    const PackedAccess *last = nullptr;
+    size_t previous = 0;                 // Accesos de los bloques anteriores
+};
+
+#endif // ACCESS_TRACE_HPP
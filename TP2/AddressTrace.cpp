@@ -0,0 +1,183 @@
+#include "AddressTrace.hpp"
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+// Tamaño de página máximo admitido (1 TiB)
+static const uint64_t MAX_PAGE_BYTES = uint64_t(1) << 40;
+
+int parsePageSize(const std::string &text)
+{
+    size_t pos = 0;
+    uint64_t bytes = 0;
+    while (pos < text.size() && std::isdigit(static_cast<unsigned char>(text[pos])))
+    {
+        bytes = bytes * 10 + (text[pos++] - '0');
+        if (bytes > MAX_PAGE_BYTES)
+            return -1;
+    }
+    if (pos == 0)
+        return -1;
+
+    std::string suffix;
+    for (; pos < text.size(); ++pos)
+    {
+        if (!std::isspace(static_cast<unsigned char>(text[pos])))
+            suffix += static_cast<char>(std::toupper(static_cast<unsigned char>(text[pos])));
+    }
+    int unit = 0;
+    if (suffix == "K" || suffix == "KB" || suffix == "KIB")
+        unit = 10;
+    else if (suffix == "M" || suffix == "MB" || suffix == "MIB")
+        unit = 20;
+    else if (suffix == "G" || suffix == "GB" || suffix == "GIB")
+        unit = 30;
+    else if (!suffix.empty() && suffix != "B")
+        return -1;
+    if (bytes > (MAX_PAGE_BYTES >> unit))
+        return -1;
+    bytes <<= unit;
+
+    if (bytes == 0 || (bytes & (bytes - 1)) != 0)
+        return -1;
+    int shift = 0;
+    while ((uint64_t(1) << shift) < bytes)
+        shift++;
+    return shift;
+}
+
+bool isAddressTrace(const char *text, size_t length)
+{
+    size_t i = 0;
+    while (i < length)
+    {
+        while (i < length && std::isspace(static_cast<unsigned char>(text[i])))
+            i++;
+        if (i == length)
+            return false;
+
+        // Las cabeceras de Valgrind ("==123== ...") y los comentarios no deciden el formato
+        if (text[i] == '=' || text[i] == '#')
+        {
+            const char *eol = static_cast<const char *>(std::memchr(text + i, '\n', length - i));
+            if (!eol)
+                return true;
+            i = eol - text + 1;
+            continue;
+        }
+        return std::isalpha(static_cast<unsigned char>(text[i])) != 0;
+    }
+    return false;
+}
+
+void AddressTokenizer::feed(const char *text, size_t length, AccessTrace &out)
+{
+    const char *pos = text;
+    const char *end = text + length;
+    while (pos < end)
+    {
+        const char *eol = static_cast<const char *>(std::memchr(pos, '\n', end - pos));
+        if (!eol)
+        {
+            partial.append(pos, end);
+            return;
+        }
+
+        if (partial.empty())
+        {
+            parseLine(pos, eol, out);
+        }
+        else
+        {
+            partial.append(pos, eol);
+            parseLine(partial.data(), partial.data() + partial.size(), out);
+            partial.clear();
+        }
+        pos = eol + 1;
+    }
+}
+
+void AddressTokenizer::finish(AccessTrace &out)
+{
+    if (!partial.empty())
+    {
+        parseLine(partial.data(), partial.data() + partial.size(), out);
+        partial.clear();
+    }
+    if (pending)
+        emit(out);
+    pending = false;
+}
+
+// Interpreta un registro "<op> <dirección>[,tamaño]"; ignora la línea si no lo es
+void AddressTokenizer::parseLine(const char *begin, const char *end, AccessTrace &out)
+{
+    const char *p = begin;
+    while (p < end && (*p == ' ' || *p == '\t'))
+        p++;
+    if (p == end)
+        return;
+
+    bool modified;
+    switch (std::toupper(static_cast<unsigned char>(*p)))
+    {
+        case 'I':
+        case 'L': modified = false; break;
+        case 'S':
+        case 'M': modified = true; break;
+        default: return;
+    }
+    while (p < end && std::isalpha(static_cast<unsigned char>(*p))) // "L" o "load"
+        p++;
+    while (p < end && (*p == ' ' || *p == '\t'))
+        p++;
+    if (end - p > 2 && p[0] == '0' && (p[1] == 'x' || p[1] == 'X'))
+        p += 2;
+
+    uint64_t address = 0;
+    const char *digits = p;
+    for (; p < end; ++p)
+    {
+        char c = *p;
+        int value;
+        if (c >= '0' && c <= '9')
+            value = c - '0';
+        else if (c >= 'a' && c <= 'f')
+            value = c - 'a' + 10;
+        else if (c >= 'A' && c <= 'F')
+            value = c - 'A' + 10;
+        else
+            break;
+        address = (address << 4) | static_cast<uint64_t>(value);
+    }
+    if (p == digits)
+        return;
+
+    // Los accesos seguidos a la misma página cuentan como uno
+    uint64_t page = address >> pageShift;
+    if (pending && page == pendingPage)
+    {
+        pendingModified = pendingModified || modified;
+        return;
+    }
+    if (pending)
+        emit(out);
+    pending = true;
+    pendingPage = page;
+    pendingModified = modified;
+}
+
+// Agrega el acceso pendiente: número denso de su región y posición dentro de ella
+void AddressTokenizer::emit(AccessTrace &out)
+{
+    auto inserted = regionIds.emplace(pendingPage >> regionBits, static_cast<int>(regionIds.size()));
+    if (inserted.first->second > (MAX_TRACE_PAGE >> regionBits))
+    {
+        std::cerr << "Error: la traza de direcciones usa más de " << (MAX_TRACE_PAGE >> regionBits) + 1
+                  << " regiones de 1 GiB distintas.\n";
+        std::exit(EXIT_FAILURE);
+    }
+    uint64_t offset = pendingPage & ((uint64_t(1) << regionBits) - 1);
+    out.push(static_cast<int>((static_cast<uint64_t>(inserted.first->second) << regionBits) | offset), pendingModified);
+}
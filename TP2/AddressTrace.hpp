@@ -0,0 +1,61 @@
+#ifndef ADDRESS_TRACE_HPP
+#define ADDRESS_TRACE_HPP
+
+#include "AccessTrace.hpp"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+/**
+ * @brief Convierte un tamaño de página como "4K", "2M", "1G" o "4096" en su logaritmo en base 2.
+ *
+ * @param text Tamaño en bytes, con sufijo K, M o G opcional (también "KiB", "MB", etc.).
+ * @return El desplazamiento (12 para 4 KiB), o -1 si no es una potencia de dos válida.
+ */
+int parsePageSize(const std::string &text);
+
+// ¿El texto parece una traza de direcciones? Decide por el primer registro que no sea
+// un comentario: las direcciones empiezan con la operación (I, L, S, M) y la traza de
+// páginas con un número o '['.
+bool isAddressTrace(const char *text, size_t length);
+
+/**
+ * @brief Parser de trazas de direcciones virtuales, como las de Valgrind Lackey.
+ *
+ * Cada línea es un registro "<op> <dirección hex>[,tamaño]": `I` (instrucción) y `L`
+ * (lectura) leen, `S` (escritura) y `M` (lectura y escritura) marcan la página como
+ * modificada. También se aceptan "load"/"store" y el prefijo "0x". Las líneas que no son
+ * registros (cabeceras "==pid==", comentarios '#') se ignoran.
+ *
+ * La dirección se convierte en página con `dirección >> pageShift` y los accesos seguidos
+ * a la misma página se colapsan en uno solo (modificado si alguno escribió). Como las
+ * páginas de un espacio de 64 bits no entran en un acceso empaquetado, cada región de
+ * 1 GiB distinta se renumera densamente en orden de primera aparición, conservando la
+ * posición de la página dentro de su región. Así las páginas contiguas siguen contiguas
+ * (y alineadas) para el TLB y las páginas grandes.
+ */
+class AddressTokenizer : public TextTokenizer
+{
+public:
+    explicit AddressTokenizer(int pageShift)
+        : pageShift(pageShift), regionBits(pageShift < REGION_SHIFT ? REGION_SHIFT - pageShift : 0) {}
+
+    void feed(const char *text, size_t length, AccessTrace &out) override;
+    void finish(AccessTrace &out) override;
+
+private:
+    void parseLine(const char *begin, const char *end, AccessTrace &out);
+    void emit(AccessTrace &out);
+
+    static const int REGION_SHIFT = 30; // Regiones de 1 GiB
+
+    int pageShift;
+    int regionBits;                              // Páginas por región: 2^regionBits
+    std::string partial;                         // Registro partido entre dos bloques
+    std::unordered_map<uint64_t, int> regionIds; // Región virtual -> número denso
+    bool pending = false;                        // ¿Hay un acceso colapsándose?
+    uint64_t pendingPage = 0;
+    bool pendingModified = false;
+};
+
+#endif // ADDRESS_TRACE_HPP
@@ -1,157 +1,113 @@
 #include "Algorithms.hpp"
+#include "IndexList.hpp"
+#include "FrameBitset.hpp"
+#include "FrameScan.hpp"
+#include "PolicyDriver.hpp"
 #include <unordered_set>
+#include <unordered_map>
+#include <set>
+#include <iterator>
+#include <algorithm>
 #include <queue>
 #include <iostream>
-#include <climits>
+#include <cstdint>
 
-/**
- * Simula el algoritmo de reemplazo de páginas FIFO.
- *
- * @param sim   Referencia al simulador con la memoria, contador de fallos, etc.
- * @param pages Secuencia de números de páginas solicitadas.
- * @param mods  Flags que indican si cada página fue modificada (*).
- */
-void runFIFO(PageReplacementSimulator &sim, const std::vector<int> &pages, const std::vector<bool> &mods)
+// Cola de FIFO y SecondChance al empezar, como marcos en orden de llegada: la que quedó en
+// sim.policyState si corresponde a las páginas cargadas (continuación desde un checkpoint),
+// o los marcos ocupados en orden
+static void restoreQueue(const PageReplacementSimulator &sim, std::queue<int> &fifoQueue)
 {
-    std::unordered_set<int> loadedPages; // Para saber qué páginas están en memoria (acceso rápido)
-    std::queue<int> fifoQueue;           // Cola para llevar el orden de llegada (FIFO)
-
-    for (size_t i = 0; i < pages.size(); ++i)
+    std::unordered_map<int, int> loaded; // Página → marco de las páginas cargadas
+    for (int j = 0; j < sim.frameCount; ++j)
     {
-        int page = pages[i];     // Página solicitada en esta iteración
-        bool modified = mods[i]; // ¿La página fue modificada? (tiene '*')
+        if (sim.memory[j].pageNumber != -1)
+            loaded.emplace(sim.memory[j].pageNumber, j);
+    }
 
-        bool hit = false; // ¿Ya está en memoria?
+    std::vector<int> queued = sim.policyState;
+    std::sort(queued.begin(), queued.end());
+    bool saved = queued.size() == loaded.size() &&
+                 std::all_of(queued.begin(), queued.end(), [&](int p) { return loaded.count(p); }) &&
+                 std::adjacent_find(queued.begin(), queued.end()) == queued.end();
+    if (saved)
+    {
+        for (int page : sim.policyState)
+            fifoQueue.push(loaded[page]);
+        return;
+    }
+    for (int j = 0; j < sim.frameCount; ++j)
+    {
+        if (sim.memory[j].pageNumber != -1)
+            fifoQueue.push(j);
+    }
+}
 
-        // Verificar si la página ya está cargada (HIT)
-        for (auto &frame : sim.memory)
-        {
-            if (frame.pageNumber == page)
-            {
-                hit = true;
-                frame.bits.R = true; // Marcar que fue referenciada
-                if (modified)
-                    frame.bits.M = true; // Marcar como modificada si corresponde
-                break;
-            }
-        }
+// Deja la cola (como páginas) en sim.policyState para continuar la simulación más tarde
+static void saveQueue(PageReplacementSimulator &sim, std::queue<int> &fifoQueue)
+{
+    sim.policyState.clear();
+    for (; !fifoQueue.empty(); fifoQueue.pop())
+        sim.policyState.push_back(sim.memory[fifoQueue.front()].pageNumber);
+}
 
-        if (hit)
-            continue; // Si ya está, no hay fallo. Pasamos al siguiente acceso.
+/**
+ * @brief Política FIFO: reemplaza la página que lleva más tiempo cargada.
+ *
+ * La cola guarda los marcos en orden de llegada de sus páginas; la víctima es la cabeza.
+ */
+class FifoPolicy : public ReplacementPolicy
+{
+public:
+    // Prellenar cola: la de una simulación anterior (checkpoint) o, con estado inicial, las
+    // páginas cargadas en orden de marco (son las más antiguas)
+    explicit FifoPolicy(PageReplacementSimulator &sim) : sim(sim) { restoreQueue(sim, fifoQueue); }
 
-        // Fallo de página: la página no está en memoria
-        sim.pageFaults++;
+    void onHit(int j, bool modified) { touchFrame(sim, j, modified); }
 
-        // Buscar un marco libre (sin página asignada)
-        bool placed = false;
-        for (auto &frame : sim.memory)
-        {
-            if (frame.pageNumber == -1)
-            {
-                // Cargar la nueva página en un marco vacío
-                frame.pageNumber = page;
-                frame.bits = {true, modified, true}; // R=1, M según bandera, V=1
-                fifoQueue.push(page);                // Registrar el orden de llegada
-                loadedPages.insert(page);            // Registrar que está en memoria
-                placed = true;
-                break;
-            }
-        }
+    // No hay marcos libres: sacar la página más antigua
+    int pickVictim()
+    {
+        int target = fifoQueue.front();
+        fifoQueue.pop();
+        return target;
+    }
 
-        if (placed)
-            continue; // Si hubo marco libre, saltamos reemplazo.
+    void onInsert(int j) { fifoQueue.push(j); } // Registrar la llegada
 
-        // No hay marcos libres: aplicar reemplazo FIFO
-        int victim = fifoQueue.front();
-        fifoQueue.pop();           // Sacar la página más antigua
-        loadedPages.erase(victim); // Eliminar de registro de cargadas
+    void finish() { saveQueue(sim, fifoQueue); }
 
-        // Reemplazar la víctima por la nueva página
-        for (auto &frame : sim.memory)
-        {
-            if (frame.pageNumber == victim)
-            {
-                frame.pageNumber = page;
-                frame.bits = {true, modified, true}; // R=1, M según bandera, V=1
-                break;
-            }
-        }
+private:
+    PageReplacementSimulator &sim;
+    std::queue<int> fifoQueue; // Marcos en orden de llegada (FIFO)
+};
 
-        // Registrar la nueva página como recién cargada
-        fifoQueue.push(page);
-        loadedPages.insert(page);
-    }
+/**
+ * Simula el algoritmo de reemplazo de páginas FIFO (ver FifoPolicy).
+ *
+ * @param sim      Referencia al simulador con la memoria, contador de fallos, etc.
+ * @param accesses Cursor sobre los accesos empaquetados (página y bit M por palabra).
+ */
+void runFIFO(PageReplacementSimulator &sim, AccessCursor &accesses)
+{
+    runPolicy<FifoPolicy>(sim, accesses);
 }
 
 /**
- * @brief Simula el algoritmo de reemplazo de páginas Second Chance (FIFO + bit R).
+ * @brief Política Second Chance (FIFO + bit R).
  *
- * Utiliza una cola circular y el bit R para decidir si una página debe ser reemplazada
+ * Utiliza la cola FIFO de marcos y el bit R para decidir si una página debe ser reemplazada
  * o reinsertada al final con su bit R en 0.
- *
- * @param sim   Referencia al simulador con la memoria, contador de fallos, etc.
- * @param pages Secuencia de números de páginas solicitadas.
- * @param mods  Flags que indican si cada página fue modificada (*).
  */
-void runSecondChance(PageReplacementSimulator &sim, const std::vector<int> &pages, const std::vector<bool> &mods)
+class SecondChancePolicy : public ReplacementPolicy
 {
-    std::queue<int> fifoQueue; // Orden FIFO para candidatos
-    std::unordered_set<int> loadedPages;
-
+public:
     // Prellenar cola si hay estado inicial para evitar errores
-    for (const auto &frame : sim.memory)
-    {
-        if (frame.pageNumber != -1)
-        {
-            fifoQueue.push(frame.pageNumber);
-            loadedPages.insert(frame.pageNumber);
-        }
-    }
+    explicit SecondChancePolicy(PageReplacementSimulator &sim) : sim(sim) { restoreQueue(sim, fifoQueue); }
 
-    for (size_t i = 0; i < pages.size(); ++i)
-    {
-        int page = pages[i];
-        bool modified = mods[i];
-        bool hit = false;
+    void onHit(int j, bool modified) { touchFrame(sim, j, modified); }
 
-        // Verificar si la página ya está cargada
-        for (auto &frame : sim.memory)
-        {
-            if (frame.pageNumber == page)
-            {
-                hit = true;
-                frame.bits.R = true;
-                if (modified)
-                    frame.bits.M = true;
-                break;
-            }
-        }
-
-        if (hit)
-            continue; // No hay fallo
-
-        // Fallo de página
-        sim.pageFaults++;
-
-        // Buscar marco libre
-        bool placed = false;
-        for (auto &frame : sim.memory)
-        {
-            if (frame.pageNumber == -1)
-            {
-                frame.pageNumber = page;
-                frame.bits = {true, modified, true};
-                fifoQueue.push(page);
-                loadedPages.insert(page);
-                placed = true;
-                break;
-            }
-        }
-
-        if (placed)
-            continue;
-
-        // No hay marcos libres: aplicar Second Chance
+    int pickVictim()
+    {
         while (true)
         {
             if (fifoQueue.empty())
@@ -162,312 +118,575 @@ void runSecondChance(PageReplacementSimulator &sim, const std::vector<int> &page
             int candidate = fifoQueue.front();
             fifoQueue.pop();
 
-            // Buscar el marco correspondiente al candidato
-            for (auto &frame : sim.memory)
-            {
-                if (frame.pageNumber == candidate)
-                {
-                    if (frame.bits.R)
-                    {
-                        frame.bits.R = false;      // Segunda oportunidad
-                        fifoQueue.push(candidate); // Lo movemos al final
-                    }
-                    else
-                    {
-                        // Reemplazo: quitar víctima
-                        loadedPages.erase(candidate);
-                        frame.pageNumber = page;
-                        frame.bits = {true, modified, true};
-                        fifoQueue.push(page);
-                        loadedPages.insert(page);
-                        break;
-                    }
-                    break;
-                }
-            }
+            if (!sim.memory[candidate].bits.R)
+                return candidate; // Reemplazo: quitar víctima
 
-            // Salimos si ya insertamos la nueva página
-            if (loadedPages.count(page))
-                break;
+            sim.memory[candidate].bits.R = false; // Segunda oportunidad
+            fifoQueue.push(candidate);            // Lo movemos al final
         }
     }
+
+    void onInsert(int j) { fifoQueue.push(j); }
+
+    void finish() { saveQueue(sim, fifoQueue); }
+
+private:
+    PageReplacementSimulator &sim;
+    std::queue<int> fifoQueue; // Orden FIFO de los marcos candidatos
+};
+
+/**
+ * @brief Simula el algoritmo de reemplazo de páginas Second Chance (ver SecondChancePolicy).
+ *
+ * @param sim      Referencia al simulador con la memoria, contador de fallos, etc.
+ * @param accesses Cursor sobre los accesos empaquetados (página y bit M por palabra).
+ */
+void runSecondChance(PageReplacementSimulator &sim, AccessCursor &accesses)
+{
+    runPolicy<SecondChancePolicy>(sim, accesses);
 }
 
 /**
- * @brief Simula el algoritmo NRU (Not Recently Used) de forma determinista.
+ * @brief Política NRU (Not Recently Used) determinista.
  *
  * Clasifica las páginas en cuatro clases basadas en los bits R (referenciado)
  * y M (modificado). Al ocurrir un fallo de página, se selecciona determinísticamente
- * la primera página encontrada en la clase más baja disponible para su reemplazo.
- * Periódicamente se reinician los bits R para simular el paso del tiempo.
+ * la página de menor índice en la clase más baja disponible para su reemplazo.
+ * Cada clase es un bitset de marcos, así que la víctima sale de un find-first-set y los
+ * fallos no asignan memoria. Un temporizador simulado reinicia los bits R cada
+ * `sim.timerInterval` accesos (0 lo desactiva) para simular el paso del tiempo.
  *
  * Clases:
  *  - Clase 0: R = 0, M = 0  → mejor candidata
  *  - Clase 1: R = 0, M = 1
  *  - Clase 2: R = 1, M = 0
  *  - Clase 3: R = 1, M = 1  → peor candidata
- *
- * @param sim   Referencia al simulador con marcos de página, contador de fallos, etc.
- * @param pages Vector con la secuencia de páginas solicitadas.
- * @param mods  Vector que indica si la página correspondiente fue modificada (con '*').
  */
-void runNRU(PageReplacementSimulator &sim, const std::vector<int> &pages, const std::vector<bool> &mods)
+class NruPolicy : public ReplacementPolicy
 {
-    for (size_t i = 0; i < pages.size(); ++i)
+public:
+    explicit NruPolicy(PageReplacementSimulator &sim)
+        : sim(sim), previous(sim.accessCount), classes(4, FrameBitset(sim.frameCount))
     {
-        int page = pages[i];
-        bool modified = mods[i];
-        bool hit = false;
+        // Clasificar los marcos ya ocupados (estado inicial)
+        for (int j = 0; j < sim.frameCount; ++j)
+        {
+            const PageFrame &frame = sim.memory[j];
+            if (frame.pageNumber != -1)
+                classes[(frame.bits.R ? 2 : 0) + (frame.bits.M ? 1 : 0)].set(j);
+        }
+    }
 
-        // Buscar si la página ya está en memoria
-        for (auto &frame : sim.memory)
+    // Acierto: pasa a la clase con R=1 (y M=1 si corresponde)
+    void onHit(int j, bool modified)
+    {
+        classes[classOf(j)].reset(j);
+        if (modified)
+            sim.memory[j].bits.M = true;
+        classes[2 + (sim.memory[j].bits.M ? 1 : 0)].set(j);
+    }
+
+    // Primer marco de la clase más baja no vacía
+    int pickVictim()
+    {
+        int target = -1;
+        for (auto &victimClass : classes)
         {
-            if (frame.pageNumber == page)
-            {
-                // Página encontrada → hit
-                hit = true;
-                frame.bits.R = true; // Se marca como referenciada
-                if (modified)
-                    frame.bits.M = true; // Se marca como modificada si corresponde
+            target = victimClass.first();
+            if (target != -1)
                 break;
-            }
         }
+        classes[classOf(target)].reset(target);
+        return target;
+    }
 
-        if (hit)
-            continue; // Si fue hit, pasamos al siguiente acceso
+    void onInsert(int j)
+    {
+        sim.memory[j].frequency = 1;
+        classes[sim.memory[j].bits.M ? 3 : 2].set(j);
+    }
 
-        // Fallo de página
-        sim.pageFaults++;
+    // Tic del temporizador: R=0 en todos los marcos (clase 2 → 0 y clase 3 → 1)
+    void afterAccess(size_t i)
+    {
+        if (sim.timerInterval > 0 && (previous + i + 1) % sim.timerInterval == 0)
+        {
+            classes[0].absorb(classes[2]);
+            classes[1].absorb(classes[3]);
+        }
+    }
 
-        // Buscar un marco libre
-        bool placed = false;
-        for (auto &frame : sim.memory)
+    // Reflejar el bit R final en los marcos
+    void finish()
+    {
+        for (int j = 0; j < sim.frameCount; ++j)
         {
-            if (frame.pageNumber == -1)
-            {
-                // Marco vacío → cargar página sin reemplazar
-                frame.pageNumber = page;
-                frame.bits = {true, modified, true};
-                frame.frequency = 1;
-                placed = true;
-                break;
-            }
+            if (sim.memory[j].pageNumber != -1)
+                sim.memory[j].bits.R = classes[2].test(j) || classes[3].test(j);
         }
+    }
 
-        if (placed)
-            continue; // Ya se colocó sin necesidad de reemplazo
+private:
+    int classOf(int j) const
+    {
+        bool referenced = classes[2].test(j) || classes[3].test(j);
+        return (referenced ? 2 : 0) + (sim.memory[j].bits.M ? 1 : 0);
+    }
 
-        // No hay marcos libres: clasificar páginas en clases NRU
-        std::vector<int> class0, class1, class2, class3;
+    PageReplacementSimulator &sim;
+    const size_t previous; // Accesos de simulaciones anteriores (fase del temporizador)
+    // Marcos por clase NRU. El bit R vive en los bitsets (clases 2 y 3) y se copia a los
+    // marcos al final, así cada tic del temporizador es un OR palabra por palabra.
+    std::vector<FrameBitset> classes;
+};
 
-        for (size_t j = 0; j < sim.memory.size(); ++j)
+/**
+ * @brief Simula el algoritmo NRU (Not Recently Used) de forma determinista (ver NruPolicy).
+ *
+ * @param sim      Referencia al simulador con marcos de página, contador de fallos, etc.
+ * @param accesses Cursor sobre los accesos empaquetados (página y bit M por palabra).
+ */
+void runNRU(PageReplacementSimulator &sim, AccessCursor &accesses)
+{
+    runPolicy<NruPolicy>(sim, accesses);
+}
+
+/**
+ * @brief Política LRU (Least Recently Used).
+ *
+ * Reemplaza la página menos recientemente utilizada. Cada marco mantiene un campo
+ * `timestamp` con el momento del último uso, y los marcos ocupados se enlazan en una lista
+ * de recencia intrusiva (índices de marcos, sin asignaciones por acceso) ordenada por
+ * (timestamp, índice): la cabeza es siempre la víctima. Con el índice página → marco del
+ * bucle común, los aciertos y los reemplazos cuestan O(1).
+ */
+class LruPolicy : public ReplacementPolicy
+{
+public:
+    explicit LruPolicy(PageReplacementSimulator &sim) : sim(sim), links(sim.frameCount), recency(links)
+    {
+        // Enlazar los marcos ya ocupados (estado inicial) en orden de (timestamp, índice).
+        std::vector<int> occupied;
+        for (int j = 0; j < sim.frameCount; ++j)
         {
-            const auto &frame = sim.memory[j];
-            bool R = frame.bits.R;
-            bool M = frame.bits.M;
-
-            if (!R && !M)
-                class0.push_back(j);
-            else if (!R && M)
-                class1.push_back(j);
-            else if (R && !M)
-                class2.push_back(j);
-            else
-                class3.push_back(j);
+            if (sim.memory[j].pageNumber != -1)
+                occupied.push_back(j);
         }
+        std::stable_sort(occupied.begin(), occupied.end(), [&](int a, int b) {
+            return sim.memory[a].timestamp < sim.memory[b].timestamp;
+        });
+        for (int j : occupied)
+            recency.pushBack(j);
+    }
 
-        // Elegir clase con mayor prioridad disponible
-        std::vector<int> *victimClass = nullptr;
-        if (!class0.empty())
-            victimClass = &class0;
-        else if (!class1.empty())
-            victimClass = &class1;
-        else if (!class2.empty())
-            victimClass = &class2;
-        else
-            victimClass = &class3;
+    void onHit(int j, bool modified)
+    {
+        PageFrame &frame = sim.memory[j];
+        frame.bits.R = true; // Se marca como referenciada.
+        if (modified)
+            frame.bits.M = true;            // Se marca como modificada si aplica.
+        frame.timestamp = sim.globalTime++; // Actualiza timestamp por acceso.
+        touch(j);
+    }
+
+    // La víctima es la página menos recientemente usada; sale de la lista al reubicarse
+    int pickVictim() { return recency.head; }
 
-        // Selección determinista: tomar el primer índice de la mejor clase
-        int victimIndex = (*victimClass)[0];
+    void onInsert(int j)
+    {
+        PageFrame &frame = sim.memory[j];
+        frame.timestamp = sim.globalTime++; // Nuevo acceso, nuevo timestamp.
+        frame.frequency = 1;                // Inicializa frecuencia (LFU/MFU).
+        touch(j);
+    }
+
+private:
+    // Reubica un marco recién usado manteniendo el orden (timestamp, índice). Como el tiempo
+    // solo avanza, casi siempre termina en la cola; solo se retrocede sobre empates.
+    void touch(int j)
+    {
+        if (links.prev[j] != -1 || links.next[j] != -1 || recency.head == j)
+            recency.remove(j);
+        int pos = recency.tail;
+        while (pos != -1 && (sim.memory[pos].timestamp > sim.memory[j].timestamp ||
+                             (sim.memory[pos].timestamp == sim.memory[j].timestamp && pos > j)))
+            pos = links.prev[pos];
+        recency.insertAfter(pos, j);
+    }
+
+    PageReplacementSimulator &sim;
+    IndexLinks links;
+    IndexList recency; // Cabeza = menos reciente, cola = más reciente.
+};
+
+/**
+ * @brief Simula el algoritmo de reemplazo de páginas LRU (ver LruPolicy).
+ *
+ * @param sim      Referencia al simulador con memoria, algoritmo, contadores, etc.
+ * @param accesses Cursor sobre los accesos empaquetados (página y bit M por palabra).
+ */
+void runLRU(PageReplacementSimulator &sim, AccessCursor &accesses)
+{
+    runPolicy<LruPolicy>(sim, accesses);
+}
+
+/**
+ * @brief Política Clock (Reloj), variante eficiente de Second Chance.
+ *
+ * Usa un puntero circular (clock hand) para recorrer los marcos.
+ * Si la página apuntada tiene R=1, se le da una segunda oportunidad (R=0 y se avanza).
+ * Si tiene R=0, se reemplaza inmediatamente y el reloj avanza al marco siguiente. Los
+ * marcos libres se ocupan sin mover el reloj.
+ */
+class ClockPolicy : public ReplacementPolicy
+{
+public:
+    // Asegurar que el puntero de reloj esté dentro de los límites
+    explicit ClockPolicy(PageReplacementSimulator &sim) : sim(sim) { sim.clockHand %= sim.frameCount; }
 
-        // Reemplazar la página víctima
-        sim.memory[victimIndex].pageNumber = page;
-        sim.memory[victimIndex].bits = {true, modified, true};
-        sim.memory[victimIndex].frequency = 1;
+    void onHit(int j, bool modified) { touchFrame(sim, j, modified); }
 
-        // Simulación del tiempo: reinicio periódico del bit R (cada 5 accesos)
-        if ((i + 1) % 5 == 0)
+    int pickVictim()
+    {
+        while (sim.memory[sim.clockHand].bits.R)
         {
-            for (auto &frame : sim.memory)
-                frame.bits.R = false;
+            // Si R=1 → darle una segunda oportunidad
+            sim.memory[sim.clockHand].bits.R = false;              // Limpiar R
+            sim.clockHand = (sim.clockHand + 1) % sim.frameCount; // Avanzar el puntero
         }
+
+        // R=0 → no ha sido referenciada recientemente → reemplazar, y avanzar el reloj
+        int target = sim.clockHand;
+        sim.clockHand = (sim.clockHand + 1) % sim.frameCount;
+        return target;
     }
-}
+
+    void onInsert(int) {}
+
+private:
+    PageReplacementSimulator &sim;
+};
 
 /**
- * @brief Simula el algoritmo de reemplazo de páginas LRU (Least Recently Used).
+ * @brief Simula el algoritmo Clock (ver ClockPolicy).
  *
- * Este algoritmo reemplaza la página menos recientemente utilizada, usando un contador
- * de tiempo global que se actualiza en cada acceso. Cada marco mantiene un campo `timestamp`
- * que indica el momento del último uso.
+ * @param sim      Referencia al simulador con marcos, contador de fallos, etc.
+ * @param accesses Cursor sobre los accesos empaquetados (página y bit M por palabra).
+ */
+void runClock(PageReplacementSimulator &sim, AccessCursor &accesses)
+{
+    runPolicy<ClockPolicy>(sim, accesses);
+}
+
+/**
+ * @brief Política WSClock (reloj del conjunto de trabajo).
  *
- * @param sim   Referencia al simulador con memoria, algoritmo, contadores, etc.
- * @param pages Secuencia de números de página solicitadas.
- * @param mods  Flags que indican si cada página fue modificada (ej. símbolo '*').
+ * El tiempo virtual avanza un tic por acceso. Cada marco guarda el tiempo virtual de su
+ * último uso, que se actualiza cuando el reloj encuentra R=1. Una página con R=0 cuya edad
+ * supera la ventana τ está fuera del conjunto de trabajo: si está limpia se reemplaza, y si
+ * está sucia se programa su escritura (queda limpia) y el reloj sigue buscando. Si el reloj
+ * da una vuelta completa, se reemplaza la primera página cuya escritura se programó; si no
+ * hubo ninguna, la página limpia más antigua, y si todas están sucias, la apuntada.
  */
-void runLRU(PageReplacementSimulator &sim, const std::vector<int> &pages, const std::vector<bool> &mods)
+class WSClockPolicy : public ReplacementPolicy
 {
-    int currentTime = 0; // Contador de tiempo para actualizar los timestamps.
+public:
+    explicit WSClockPolicy(PageReplacementSimulator &sim) : sim(sim), tau(std::max(1, sim.workingSetWindow))
+    {
+        sim.clockHand %= sim.frameCount;
+    }
+
+    void onAccess(size_t) { now = ++sim.globalTime; } // Tiempo virtual del proceso
+
+    void onHit(int j, bool modified)
+    {
+        PageFrame &frame = sim.memory[j];
+        frame.bits.R = true;
+        if (modified)
+            frame.bits.M = true;
+    }
 
-    for (size_t i = 0; i < pages.size(); ++i)
+    // Recorre el reloj buscando una víctima a partir de la manecilla
+    int pickVictim()
     {
-        int page = pages[i];     // Página solicitada en esta iteración.
-        bool modified = mods[i]; // Indica si esta página fue modificada.
-        bool hit = false;        // Indica si la página ya está en memoria.
+        int scheduled = -1;   // Primera página sucia cuya escritura se programó
+        int oldestClean = -1; // Página limpia más antigua dentro del conjunto de trabajo
 
-        // Verificar si la página ya se encuentra cargada (HIT).
-        for (auto &frame : sim.memory)
+        for (int step = 0; step < sim.frameCount; ++step)
         {
-            if (frame.pageNumber == page)
+            int j = sim.clockHand;
+            PageFrame &frame = sim.memory[j];
+            sim.clockHand = (sim.clockHand + 1) % sim.frameCount;
+
+            if (frame.bits.R)
             {
-                hit = true;
-                frame.bits.R = true; // Se marca como referenciada.
-                if (modified)
-                    frame.bits.M = true;         // Se marca como modificada si aplica.
-                frame.timestamp = currentTime++; // Actualiza timestamp por acceso.
-                break;
+                // Usada desde la última vuelta: sigue en el conjunto de trabajo
+                frame.bits.R = false;
+                frame.timestamp = now;
+                continue;
             }
+
+            if (now - frame.timestamp > tau)
+            {
+                if (!frame.bits.M)
+                    return j; // Fuera del conjunto de trabajo y limpia
+
+                // Fuera del conjunto de trabajo pero sucia: se escribe a disco y se sigue
+                frame.bits.M = false;
+                sim.writebacks++;
+                if (scheduled == -1)
+                    scheduled = j;
+                continue;
+            }
+
+            if (!frame.bits.M && (oldestClean == -1 || frame.timestamp < sim.memory[oldestClean].timestamp))
+                oldestClean = j;
         }
 
-        if (hit)
-            continue; // No hay fallo, se continúa con el siguiente acceso.
+        int victim = (scheduled != -1) ? scheduled : (oldestClean != -1) ? oldestClean : sim.clockHand;
+        sim.clockHand = (victim + 1) % sim.frameCount;
+        return victim;
+    }
+
+    void onInsert(int j) { sim.memory[j].timestamp = now; }
+
+private:
+    PageReplacementSimulator &sim;
+    const int tau;
+    int64_t now = 0;
+};
+
+/**
+ * @brief Simula el algoritmo WSClock (ver WSClockPolicy).
+ *
+ * @param sim      Referencia al simulador con marcos, contador de fallos, etc.
+ * @param accesses Cursor sobre los accesos empaquetados (página y bit M por palabra).
+ */
+void runWSClock(PageReplacementSimulator &sim, AccessCursor &accesses)
+{
+    runPolicy<WSClockPolicy>(sim, accesses);
+}
+
+/**
+ * @brief Política DirtyClock, la variante de Clock que prefiere desalojar páginas limpias.
+ *
+ * Es el reloj mejorado de segunda oportunidad: clasifica los marcos por (R, M). Una primera
+ * vuelta busca (0, 0) sin modificar bits; si no la encuentra, una segunda busca (0, 1)
+ * limpiando R en los marcos que salta. Si tampoco hay, se repite: tras la segunda vuelta
+ * todos tienen R=0. Así una página sucia solo se desaloja (y se escribe a disco) cuando no
+ * queda ninguna limpia sin referenciar.
+ */
+class DirtyClockPolicy : public ReplacementPolicy
+{
+public:
+    explicit DirtyClockPolicy(PageReplacementSimulator &sim) : sim(sim) { sim.clockHand %= sim.frameCount; }
 
-        // Fallo de página: la página no estaba cargada.
-        sim.pageFaults++;
+    void onHit(int j, bool modified) { touchFrame(sim, j, modified); }
 
-        // Buscar un marco libre (sin página cargada).
-        bool placed = false;
-        for (auto &frame : sim.memory)
+    int pickVictim()
+    {
+        while (true)
         {
-            if (frame.pageNumber == -1)
+            // Primera vuelta: (R=0, M=0) sin tocar los bits
+            for (int step = 0; step < sim.frameCount; ++step)
             {
-                // Cargar la nueva página en un marco libre.
-                frame.pageNumber = page;
-                frame.bits = {true, modified, true}; // R=1, M=modificado, V=1
-                frame.timestamp = currentTime++;     // Se actualiza el timestamp.
-                frame.frequency = 1;                 // Inicializa frecuencia (LFU/MFU).
-                placed = true;
-                break;
+                int j = sim.clockHand;
+                sim.clockHand = (sim.clockHand + 1) % sim.frameCount;
+                if (!sim.memory[j].bits.R && !sim.memory[j].bits.M)
+                    return j;
             }
-        }
 
-        if (placed)
-            continue; // Se usó un marco libre, sin necesidad de reemplazo.
-
-        // No hay marcos libres: buscar la página menos recientemente usada (menor timestamp).
-        int lruIndex = 0;
-        int minTime = sim.memory[0].timestamp;
-        for (int j = 1; j < sim.frameCount; ++j)
-        {
-            if (sim.memory[j].timestamp < minTime)
+            // Segunda vuelta: (R=0, M=1), dando segunda oportunidad a las referenciadas
+            for (int step = 0; step < sim.frameCount; ++step)
             {
-                minTime = sim.memory[j].timestamp;
-                lruIndex = j;
+                int j = sim.clockHand;
+                sim.clockHand = (sim.clockHand + 1) % sim.frameCount;
+                if (!sim.memory[j].bits.R)
+                    return j;
+                sim.memory[j].bits.R = false;
             }
         }
-
-        // Reemplazar la página menos recientemente usada.
-        sim.memory[lruIndex].pageNumber = page;
-        sim.memory[lruIndex].bits = {true, modified, true}; // Se actualiza el estado.
-        sim.memory[lruIndex].timestamp = currentTime++;     // Nuevo acceso, nuevo timestamp.
-        sim.memory[lruIndex].frequency = 1;                 // Reinicia frecuencia.
     }
+
+    void onInsert(int) {}
+
+private:
+    PageReplacementSimulator &sim;
+};
+
+/**
+ * @brief Simula DirtyClock (ver DirtyClockPolicy).
+ *
+ * @param sim      Referencia al simulador con marcos, contador de fallos, etc.
+ * @param accesses Cursor sobre los accesos empaquetados (página y bit M por palabra).
+ */
+void runDirtyClock(PageReplacementSimulator &sim, AccessCursor &accesses)
+{
+    runPolicy<DirtyClockPolicy>(sim, accesses);
 }
 
 /**
- * @brief Simula el algoritmo Clock (Reloj), variante eficiente de Second Chance.
+ * @brief Cubetas de frecuencia para LFU/MFU.
  *
- * Usa un puntero circular (clock hand) para recorrer los marcos.
- * Si la página apuntada tiene R=1, se le da una segunda oportunidad (R=0 y se avanza).
- * Si tiene R=0, se reemplaza inmediatamente.
+ * Agrupa los marcos ocupados por frecuencia de uso. Dentro de cada cubeta los marcos
+ * quedan ordenados por momento de carga (timestamp, índice), que es el desempate FIFO.
+ * Las cubetas no vacías forman una lista intrusiva ordenada por frecuencia sobre un arreglo
+ * fijo de frameCount + 1 cubetas, así que la víctima LFU es el primer marco de la cabeza y
+ * la víctima MFU el primero de la cola, ambas en O(1).
  *
- * @param sim   Referencia al simulador con marcos, contador de fallos, etc.
- * @param pages Secuencia de páginas solicitadas.
- * @param mods  Vector que indica si cada página fue modificada (*).
+ * Un acierto mueve el nodo del marco (extract) a la cubeta siguiente, que es la vecina de
+ * la lista o una nueva enlazada a continuación, y el nodo de la víctima se reutiliza para la
+ * página que la reemplaza: pasado el arranque, ni aciertos ni fallos asignan memoria. La
+ * inserción dentro de la cubeta es ordenada (O(log n)) porque el nodo conserva su momento
+ * de carga. Solo cargar una página con frecuencia previa (de la historia global) recorre la
+ * lista desde la frecuencia más baja para ubicar su cubeta.
  */
-void runClock(PageReplacementSimulator &sim, const std::vector<int> &pages, const std::vector<bool> &mods)
+struct FrequencyBuckets
 {
-    // Asegurar que el puntero de reloj esté dentro de los límites
-    sim.clockHand %= sim.frameCount;
+    using Bucket = std::set<std::pair<int64_t, int>>; // {(timestamp, marco)}
+
+    std::vector<Bucket> buckets;  // Cubetas por ranura (frameCount + 1: una más durante un acierto)
+    std::vector<int> frequency;   // Frecuencia de cada ranura en uso
+    std::vector<int> freeSlots;   // Ranuras sin cubeta
+    IndexLinks links;
+    IndexList order;              // Ranuras en uso, de menor a mayor frecuencia
+    std::vector<int> frameBucket; // Marco → ranura de su cubeta
+    Bucket::node_type spare;      // Nodo de la última víctima, para la próxima carga
+
+    explicit FrequencyBuckets(int frames)
+        : buckets(frames + 1), frequency(frames + 1, 0), links(frames + 1), order(links), frameBucket(frames, -1)
+    {
+        for (int slot = frames; slot >= 0; --slot)
+            freeSlots.push_back(slot);
+    }
 
-    for (size_t i = 0; i < pages.size(); ++i)
+    void insert(const PageFrame &frame, int index)
     {
-        int page = pages[i];     // Página solicitada en esta iteración
-        bool modified = mods[i]; // ¿La página fue modificada en este acceso?
-        bool hit = false;        // ¿La página ya estaba en memoria?
+        // Última cubeta con frecuencia menor: la nueva página va en la siguiente
+        int before = -1;
+        int slot = order.head;
+        while (slot != -1 && frequency[slot] < frame.frequency)
+        {
+            before = slot;
+            slot = links.next[slot];
+        }
+        if (slot == -1 || frequency[slot] != frame.frequency)
+            slot = open(before, frame.frequency);
 
-        // Verificar si la página ya se encuentra en memoria (HIT)
-        for (auto &frame : sim.memory)
+        if (spare.empty())
+            buckets[slot].emplace(frame.timestamp, index);
+        else
         {
-            if (frame.pageNumber == page)
-            {
-                // La página ya está cargada
-                hit = true;
-                frame.bits.R = true; // Marcar como referenciada
-                if (modified)
-                    frame.bits.M = true; // Marcar como modificada si aplica
-                break;
-            }
+            spare.value() = {frame.timestamp, index};
+            buckets[slot].insert(std::move(spare));
         }
+        frameBucket[index] = slot;
+    }
 
-        if (hit)
-            continue; // No hay fallo, se continúa con el siguiente acceso
+    // El marco pasa a la cubeta de la frecuencia siguiente con su mismo momento de carga
+    void promote(const PageFrame &frame, int index)
+    {
+        int slot = frameBucket[index];
+        int next = links.next[slot];
+        if (next == -1 || frequency[next] != frequency[slot] + 1)
+            next = open(slot, frequency[slot] + 1);
+        buckets[next].insert(buckets[slot].extract({frame.timestamp, index}));
+        frameBucket[index] = next;
+        closeIfEmpty(slot);
+    }
 
-        // Fallo de página: la página no estaba cargada
-        sim.pageFaults++;
+    void erase(const PageFrame &frame, int index)
+    {
+        int slot = frameBucket[index];
+        spare = buckets[slot].extract({frame.timestamp, index});
+        frameBucket[index] = -1;
+        closeIfEmpty(slot);
+    }
+
+    int leastFrequent() const { return buckets[order.head].begin()->second; }
+    int mostFrequent() const { return buckets[order.tail].begin()->second; }
+
+private:
+    // Enlaza una cubeta vacía de frecuencia `value` a continuación de la ranura `after`
+    int open(int after, int value)
+    {
+        int slot = freeSlots.back();
+        freeSlots.pop_back();
+        frequency[slot] = value;
+        order.insertAfter(after, slot);
+        return slot;
+    }
 
-        // Buscar un marco libre
-        bool placed = false;
-        for (auto &frame : sim.memory)
+    void closeIfEmpty(int slot)
+    {
+        if (!buckets[slot].empty())
+            return;
+        order.remove(slot);
+        freeSlots.push_back(slot);
+    }
+};
+
+/**
+ * @brief Política común de LFU y MFU sobre cubetas de frecuencia.
+ *
+ * La frecuencia de una página cargada sigue la historia global de la traza
+ * (`sim.globalFrequencies`), y el momento de carga es el desempate FIFO.
+ *
+ * @tparam MostFrequent true para MFU (reemplaza la de mayor frecuencia), false para LFU.
+ */
+template <bool MostFrequent>
+class FrequencyPolicy : public ReplacementPolicy
+{
+public:
+    explicit FrequencyPolicy(PageReplacementSimulator &sim) : sim(sim), buckets(sim.frameCount)
+    {
+        // Registrar los marcos ya ocupados (estado inicial)
+        for (int j = 0; j < sim.frameCount; ++j)
         {
-            if (frame.pageNumber == -1)
-            {
-                // Encontramos un marco libre → colocamos la nueva página aquí
-                frame.pageNumber = page;
-                frame.bits = {true, modified, true}; // R=1, M=modificado, V=1
-                placed = true;
-                break;
-            }
+            if (sim.memory[j].pageNumber != -1)
+                buckets.insert(sim.memory[j], j);
         }
+    }
 
-        if (placed)
-            continue; // Se usó un marco libre, no se requiere reemplazo
+    void onAccess(size_t) { sim.globalTime++; } // Avanzar tiempo global
 
-        // No hay marcos libres → aplicar algoritmo Clock
-        while (true)
-        {
-            // Obtener el marco apuntado por el reloj
-            PageFrame &candidate = sim.memory[sim.clockHand];
+    void onHit(int j, bool modified)
+    {
+        PageFrame &frame = sim.memory[j];
+        touchFrame(sim, j, modified);
+        buckets.promote(frame, j);
+        frame.frequency++; // Aumentar frecuencia (pasó a la cubeta siguiente)
+    }
 
-            if (!candidate.bits.R)
-            {
-                // Si R=0 → no ha sido referenciada recientemente → reemplazar
-                candidate.pageNumber = page;
-                candidate.bits = {true, modified, true}; // Nuevo estado de la página cargada
+    // Reemplazo con desempate por timestamp (FIFO) dentro de la cubeta
+    int pickVictim()
+    {
+        int target = MostFrequent ? buckets.mostFrequent() : buckets.leastFrequent();
+        buckets.erase(sim.memory[target], target);
+        return target;
+    }
 
-                // Avanzar el reloj para la siguiente iteración futura
-                sim.clockHand = (sim.clockHand + 1) % sim.frameCount;
-                break;
-            }
-            else
-            {
-                // Si R=1 → darle una segunda oportunidad
-                candidate.bits.R = false;                             // Limpiar R
-                sim.clockHand = (sim.clockHand + 1) % sim.frameCount; // Avanzar el puntero
-            }
-        }
+    void onInsert(int j)
+    {
+        PageFrame &frame = sim.memory[j];
+        frame.frequency = ++sim.globalFrequencies[frame.pageNumber];
+        frame.timestamp = sim.globalTime;
+        buckets.insert(frame, j);
     }
-}
+
+    // La historia de frecuencias tiene una entrada por cada página distinta vista, así que
+    // crece con la traza (W-TinyLFU usa en cambio un sketch de tamaño fijo)
+    void finish()
+    {
+        const auto &history = sim.globalFrequencies;
+        sim.metadataBytes = history.bucket_count() * sizeof(void *) +
+                            history.size() * (sizeof(std::pair<const int, int>) + sizeof(void *));
+    }
+
+private:
+    PageReplacementSimulator &sim;
+    FrequencyBuckets buckets;
+};
 
 /**
  * @brief Ejecuta el algoritmo de reemplazo de páginas LFU (Least Frequently Used).
@@ -475,136 +694,302 @@ void runClock(PageReplacementSimulator &sim, const std::vector<int> &pages, cons
  * Este algoritmo selecciona para reemplazo el marco con la menor frecuencia de uso.
  * En caso de empate en la frecuencia, se aplica desempate por orden de llegada (FIFO).
  *
- * @param sim   Referencia al simulador con marcos, contador de fallos, etc.
- * @param pages Secuencia de páginas solicitadas.
- * @param mods  Vector que indica si cada página fue modificada (*).
+ * @param sim      Referencia al simulador con marcos, contador de fallos, etc.
+ * @param accesses Cursor sobre los accesos empaquetados (página y bit M por palabra).
  */
-void runLFU(PageReplacementSimulator &sim, const std::vector<int> &pages, const std::vector<bool> &mods) {
-    for (size_t i = 0; i < pages.size(); ++i) {
-        int page = pages[i];
-        bool modified = mods[i];
-        bool hit = false;
-        sim.globalTime++;  // Avanzar tiempo global
-
-        // Buscar si la página ya está cargada
-        for (auto &frame : sim.memory) {
-            if (frame.pageNumber == page) {
-                hit = true;
-                frame.bits.R = true;
-                if (modified)
-                    frame.bits.M = true;
-                frame.frequency++;  // Aumentar frecuencia
-                break;
-            }
-        }
-
-        if (hit)
-            continue;
+void runLFU(PageReplacementSimulator &sim, AccessCursor &accesses) {
+    runPolicy<FrequencyPolicy<false>>(sim, accesses);
+}
 
-        // Fallo de página
-        sim.pageFaults++;
+/**
+ * @brief Ejecuta el algoritmo de reemplazo de páginas MFU (Most Frequently Used).
+ *
+ * Este algoritmo selecciona para reemplazo el marco con la mayor frecuencia de uso.
+ * En caso de empate en la frecuencia, se aplica desempate por orden de llegada (FIFO).
+ *
+ * @param sim      Referencia al simulador con marcos, contador de fallos, etc.
+ * @param accesses Cursor sobre los accesos empaquetados (página y bit M por palabra).
+ */
+void runMFU(PageReplacementSimulator &sim, AccessCursor &accesses) {
+    runPolicy<FrequencyPolicy<true>>(sim, accesses);
+}
 
-        bool placed = false;
-        for (auto &frame : sim.memory) {
-            if (frame.pageNumber == -1) {
-                frame.pageNumber = page;
-                frame.bits = {true, modified, true};
-                frame.frequency = ++sim.globalFrequencies[page];
-                frame.timestamp = sim.globalTime;
-                placed = true;
-                break;
-            }
+/**
+ * @brief Política óptima de Belady (OPT) sobre los próximos usos ya calculados.
+ *
+ * Los marcos ocupados se mantienen en un conjunto ordenado por próximo uso; la víctima es
+ * la página que se usará más tarde (o nunca).
+ */
+class OptPolicy : public ReplacementPolicy
+{
+public:
+    OptPolicy(PageReplacementSimulator &sim, const std::vector<size_t> &nextUse,
+              const std::unordered_map<int, size_t> &upcoming, size_t never)
+        : sim(sim), nextUse(nextUse), frameNext(sim.frameCount, never)
+    {
+        // Marcos ya ocupados (estado inicial): su próximo uso es el primer acceso a la página
+        for (int j = 0; j < sim.frameCount; ++j)
+        {
+            int page = sim.memory[j].pageNumber;
+            if (page == -1)
+                continue;
+            auto it = upcoming.find(page);
+            frameNext[j] = (it == upcoming.end()) ? never : it->second;
+            byNextUse.emplace(frameNext[j], j);
         }
+    }
 
-        if (!placed) {
-            // Reemplazo LFU con desempate por timestamp (FIFO)
-            int minFreq = INT_MAX;
-            int oldestTime = INT_MAX;
-            int victimIndex = -1;
-
-            for (int j = 0; j < sim.frameCount; ++j) {
-                const auto &frame = sim.memory[j];
-                if (frame.frequency < minFreq || (frame.frequency == minFreq && frame.timestamp < oldestTime)) {
-                    minFreq = frame.frequency;
-                    oldestTime = frame.timestamp;
-                    victimIndex = j;
-                }
-            }
+    void onAccess(size_t i) { current = i; }
 
-            sim.memory[victimIndex].pageNumber = page;
-            sim.memory[victimIndex].bits = {true, modified, true};
-            sim.memory[victimIndex].frequency = ++sim.globalFrequencies[page];
-            sim.memory[victimIndex].timestamp = sim.globalTime;
-        }
+    // Acierto: actualizar bits y el próximo uso del marco
+    void onHit(int j, bool modified)
+    {
+        touchFrame(sim, j, modified);
+        byNextUse.erase({frameNext[j], j});
+        frameNext[j] = nextUse[current];
+        byNextUse.emplace(frameNext[j], j);
     }
-}
+
+    int pickVictim()
+    {
+        auto victim = std::prev(byNextUse.end());
+        int target = victim->second;
+        byNextUse.erase(victim);
+        return target;
+    }
+
+    void onInsert(int j)
+    {
+        frameNext[j] = nextUse[current];
+        byNextUse.emplace(frameNext[j], j);
+    }
+
+private:
+    PageReplacementSimulator &sim;
+    const std::vector<size_t> &nextUse;
+    std::vector<size_t> frameNext;
+    std::set<std::pair<size_t, int>> byNextUse; // (próximo uso, marco) de los marcos ocupados
+    size_t current = 0;                         // Posición del acceso en curso
+};
 
 /**
- * @brief Ejecuta el algoritmo de reemplazo de páginas MFU (Most Frequently Used).
+ * @brief Simula el algoritmo óptimo de Belady (OPT).
  *
- * Este algoritmo selecciona para reemplazo el marco con la mayor frecuencia de uso.
- * En caso de empate en la frecuencia, se aplica desempate por orden de llegada (FIFO).
+ * Reemplaza la página cuyo próximo uso está más lejos en el futuro; sirve como cota
+ * inferior de fallos para comparar los demás algoritmos. Una pasada hacia atrás calcula
+ * para cada acceso la posición del siguiente acceso a la misma página, y los marcos
+ * ocupados se mantienen en un conjunto ordenado por próximo uso, de modo que cada acceso
+ * cuesta O(log marcos).
  *
  * @param sim   Referencia al simulador con marcos, contador de fallos, etc.
- * @param pages Secuencia de páginas solicitadas.
- * @param mods  Vector que indica si cada página fue modificada (*).
+ * @param trace Secuencia de accesos empaquetados (página y bit M por palabra).
  */
-void runMFU(PageReplacementSimulator &sim, const std::vector<int> &pages, const std::vector<bool> &mods) {
-    for (size_t i = 0; i < pages.size(); ++i) {
-        int page = pages[i];
-        bool modified = mods[i];
-        bool hit = false;
-        sim.globalTime++;  // Avanzar tiempo global
-
-        // Buscar si la página ya está cargada
-        for (auto &frame : sim.memory) {
-            if (frame.pageNumber == page) {
-                hit = true;
-                frame.bits.R = true;
-                if (modified)
-                    frame.bits.M = true;
-                frame.frequency++;  // Aumentar frecuencia
-                break;
+void runOPT(PageReplacementSimulator &sim, const AccessTrace &trace)
+{
+    const size_t never = trace.size(); // Próximo uso de una página que no vuelve a pedirse
+
+    // Pasada hacia atrás: nextUse[i] = posición del siguiente acceso a la página del acceso i
+    std::vector<size_t> nextUse(trace.size());
+    std::unordered_map<int, size_t> upcoming; // Página → próxima posición vista desde atrás
+    for (size_t i = trace.size(); i-- > 0;)
+    {
+        auto it = upcoming.find(trace.page(i));
+        nextUse[i] = (it == upcoming.end()) ? never : it->second;
+        upcoming[trace.page(i)] = i;
+    }
+
+    OptPolicy policy(sim, nextUse, upcoming, never);
+    AccessCursor accesses(trace);
+    runPolicyLoop(sim, accesses, policy);
+}
+
+/**
+ * @brief Política Aging para un ancho de contador dado (uint8_t, uint16_t o uint32_t).
+ *
+ * Contadores y bits R se guardan en arreglos contiguos separados de los marcos, de modo
+ * que el desplazamiento de todos los contadores en cada tic es un bucle simple que el
+ * compilador vectoriza, y la víctima sale de un argmin AVX2 sobre las claves (FrameScan).
+ */
+template <typename Counter>
+class AgingPolicy : public ReplacementPolicy
+{
+public:
+    explicit AgingPolicy(PageReplacementSimulator &sim)
+        : sim(sim), previous(sim.accessCount), counters(sim.frameCount, 0), referenced(sim.frameCount, 0),
+          keys(sim.frameCount, 0)
+    {
+        // Contadores de una simulación anterior (checkpoint), si los hay
+        bool saved = static_cast<int>(sim.policyState.size()) == sim.frameCount;
+        for (int j = 0; j < sim.frameCount; ++j)
+        {
+            if (sim.memory[j].pageNumber != -1)
+            {
+                referenced[j] = sim.memory[j].bits.R;
+                if (saved)
+                    counters[j] = static_cast<Counter>(sim.policyState[j]);
             }
         }
+    }
 
-        if (hit)
-            continue;
+    // Acierto: solo se marca R; el contador se actualiza en el próximo tic
+    void onHit(int j, bool modified)
+    {
+        referenced[j] = 1;
+        if (modified)
+            sim.memory[j].bits.M = true;
+    }
+
+    // Víctima: menor contador como si el tic ocurriera ahora (así una página recién
+    // referenciada no pierde frente a una vieja sin referencias). Empates → menor índice.
+    int pickVictim()
+    {
+        // Punteros locales: un contador de 8 bits puede ser alias de cualquier miembro, y sin
+        // ellos el compilador recarga los arreglos en cada vuelta y no vectoriza el bucle
+        const int count = sim.frameCount;
+        const Counter *counter = counters.data();
+        const Counter *reference = referenced.data();
+        Counter *key = keys.data();
+        for (int j = 0; j < count; ++j)
+            key[j] = static_cast<Counter>((counter[j] >> 1) | (reference[j] << shift));
+        return argMinFrame(key, count);
+    }
 
-        // Fallo de página
-        sim.pageFaults++;
+    void onInsert(int j)
+    {
+        counters[j] = 0;
+        referenced[j] = 1;
+    }
 
-        bool placed = false;
-        for (auto &frame : sim.memory) {
-            if (frame.pageNumber == -1) {
-                frame.pageNumber = page;
-                frame.bits = {true, modified, true};
-                frame.frequency = ++sim.globalFrequencies[page];
-                frame.timestamp = sim.globalTime;
-                placed = true;
-                break;
+    // Tic del temporizador: desplazar todos los contadores e insertar R por la izquierda
+    void afterAccess(size_t i)
+    {
+        if (sim.timerInterval > 0 && (previous + i + 1) % sim.timerInterval == 0)
+        {
+            const int count = sim.frameCount;
+            Counter *counter = counters.data();
+            Counter *reference = referenced.data();
+            for (int j = 0; j < count; ++j)
+            {
+                counter[j] = static_cast<Counter>((counter[j] >> 1) | (reference[j] << shift));
+                reference[j] = 0;
             }
         }
+    }
 
-        if (!placed) {
-            // Reemplazo MFU con desempate por timestamp (FIFO inverso)
-            int maxFreq = -1;
-            int oldestTime = INT_MAX;
-            int victimIndex = -1;
-
-            for (int j = 0; j < sim.frameCount; ++j) {
-                const auto &frame = sim.memory[j];
-                if (frame.frequency > maxFreq || (frame.frequency == maxFreq && frame.timestamp < oldestTime)) {
-                    maxFreq = frame.frequency;
-                    oldestTime = frame.timestamp;
-                    victimIndex = j;
-                }
-            }
+    // Reflejar el bit R final en los marcos y guardar los contadores para continuar
+    void finish()
+    {
+        sim.policyState.assign(sim.frameCount, 0);
+        for (int j = 0; j < sim.frameCount; ++j)
+        {
+            if (sim.memory[j].pageNumber != -1)
+                sim.memory[j].bits.R = referenced[j] != 0;
+            sim.policyState[j] = static_cast<int>(counters[j]);
+        }
+    }
+
+private:
+    static constexpr int shift = static_cast<int>(sizeof(Counter) * 8) - 1;
+
+    PageReplacementSimulator &sim;
+    const size_t previous;           // Accesos de simulaciones anteriores (fase del temporizador)
+    std::vector<Counter> counters;   // Registro de envejecimiento por marco
+    std::vector<Counter> referenced; // Bit R del tic en curso (0 o 1)
+    std::vector<Counter> keys;       // Contador con el tic en curso aplicado
+};
+
+/**
+ * @brief Simula el algoritmo Aging (envejecimiento con registro de desplazamiento).
+ *
+ * Cada marco tiene un contador de `sim.agingBits` bits (8, 16 o 32). En cada tic del
+ * temporizador (cada `sim.timerInterval` accesos) el contador se desplaza a la derecha y
+ * el bit R entra por el bit más significativo. Se reemplaza la página con el contador más
+ * bajo, lo que aproxima LRU con el costo de mantener solo el bit R por acceso.
+ *
+ * @param sim      Referencia al simulador con marcos, contador de fallos, etc.
+ * @param accesses Cursor sobre los accesos empaquetados (página y bit M por palabra).
+ */
+void runAging(PageReplacementSimulator &sim, AccessCursor &accesses)
+{
+    if (sim.agingBits == 16)
+        runPolicy<AgingPolicy<uint16_t>>(sim, accesses);
+    else if (sim.agingBits == 32)
+        runPolicy<AgingPolicy<uint32_t>>(sim, accesses);
+    else if (sim.agingBits == 8)
+        runPolicy<AgingPolicy<uint8_t>>(sim, accesses);
+    else
+    {
+        std::cerr << "Error: el contador de Aging debe tener 8, 16 o 32 bits.\n";
+        std::exit(EXIT_FAILURE);
+    }
+}
 
-            sim.memory[victimIndex].pageNumber = page;
-            sim.memory[victimIndex].bits = {true, modified, true};
-            sim.memory[victimIndex].frequency = ++sim.globalFrequencies[page];
-            sim.memory[victimIndex].timestamp = sim.globalTime;
+// Simulación en una sola pasada de cada algoritmo de reemplazo. Las políticas sobre el
+// bucle común son instancias de runPolicy; Aging elige el ancho de su contador al ejecutar,
+// y los algoritmos con historia de páginas fantasma tienen su propio bucle.
+struct AlgorithmRunner
+{
+    ReplacementAlgorithm algorithm;
+    void (*run)(PageReplacementSimulator &, AccessCursor &);
+};
+
+static const AlgorithmRunner ALGORITHM_RUNNERS[] = {
+    {ReplacementAlgorithm::FIFO, runPolicy<FifoPolicy>},
+    {ReplacementAlgorithm::SecondChance, runPolicy<SecondChancePolicy>},
+    {ReplacementAlgorithm::NRU, runPolicy<NruPolicy>},
+    {ReplacementAlgorithm::LRU, runPolicy<LruPolicy>},
+    {ReplacementAlgorithm::Clock, runPolicy<ClockPolicy>},
+    {ReplacementAlgorithm::WSClock, runPolicy<WSClockPolicy>},
+    {ReplacementAlgorithm::DirtyClock, runPolicy<DirtyClockPolicy>},
+    {ReplacementAlgorithm::LFU, runPolicy<FrequencyPolicy<false>>},
+    {ReplacementAlgorithm::MFU, runPolicy<FrequencyPolicy<true>>},
+    {ReplacementAlgorithm::Aging, runAging},
+    {ReplacementAlgorithm::ARC, runARC},
+    {ReplacementAlgorithm::TwoQ, runTwoQ},
+    {ReplacementAlgorithm::LIRS, runLIRS},
+    {ReplacementAlgorithm::ClockPro, runClockPro},
+    {ReplacementAlgorithm::WTinyLFU, runWTinyLFU},
+};
+
+/**
+ * @brief Ejecuta el algoritmo de reemplazo indicado en `sim.algorithm` en una sola pasada.
+ *
+ * Es el único punto de despacho entre el enum y las simulaciones (ALGORITHM_RUNNERS), usado
+ * por la ejecución simple, el ranking, el barrido y el procesamiento en streaming.
+ *
+ * @param sim      Referencia al simulador con marcos, contador de fallos, etc.
+ * @param accesses Cursor sobre los accesos empaquetados (página y bit M por palabra).
+ * @return false si `sim.algorithm` no es un algoritmo de reemplazo o es OPT.
+ */
+bool runAlgorithm(PageReplacementSimulator &sim, AccessCursor &accesses)
+{
+    for (const AlgorithmRunner &runner : ALGORITHM_RUNNERS)
+    {
+        if (runner.algorithm == sim.algorithm)
+        {
+            runner.run(sim, accesses);
+            sim.accessCount += accesses.consumed();
+            return true;
         }
     }
+    return false;
+}
+
+/**
+ * @brief Ejecuta el algoritmo de reemplazo indicado en `sim.algorithm` sobre una traza en memoria.
+ *
+ * @param sim   Referencia al simulador con marcos, contador de fallos, etc.
+ * @param trace Secuencia de accesos empaquetados (página y bit M por palabra).
+ * @return false si `sim.algorithm` no es un algoritmo de reemplazo.
+ */
+bool runAlgorithm(PageReplacementSimulator &sim, const AccessTrace &trace)
+{
+    if (sim.algorithm == ReplacementAlgorithm::OPT)
+    {
+        runOPT(sim, trace);
+        sim.accessCount += trace.size();
+        return true;
+    }
+    AccessCursor accesses(trace);
+    return runAlgorithm(sim, accesses);
 }
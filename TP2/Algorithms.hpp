@@ -2,15 +2,52 @@
 #define ALGORITHMS_HPP
 
 #include "PageReplacement.hpp"
-#include <vector>
+#include "AccessTrace.hpp"
 
 // Una función por algoritmo
-void runFIFO(PageReplacementSimulator &sim, const std::vector<int> &pages, const std::vector<bool> &mods);
-void runSecondChance(PageReplacementSimulator &sim, const std::vector<int> &pages, const std::vector<bool> &mods);
-void runNRU(PageReplacementSimulator &sim, const std::vector<int> &pages, const std::vector<bool> &mods);
-void runLRU(PageReplacementSimulator &sim, const std::vector<int> &pages, const std::vector<bool> &mods);
-void runClock(PageReplacementSimulator &sim, const std::vector<int> &pages, const std::vector<bool> &mods);
-void runLFU(PageReplacementSimulator &sim, const std::vector<int> &pages, const std::vector<bool> &mods);
-void runMFU(PageReplacementSimulator &sim, const std::vector<int> &pages, const std::vector<bool> &mods);
+void runFIFO(PageReplacementSimulator &sim, AccessCursor &accesses);
+void runSecondChance(PageReplacementSimulator &sim, AccessCursor &accesses);
+void runNRU(PageReplacementSimulator &sim, AccessCursor &accesses);
+void runLRU(PageReplacementSimulator &sim, AccessCursor &accesses);
+void runClock(PageReplacementSimulator &sim, AccessCursor &accesses);
+void runWSClock(PageReplacementSimulator &sim, AccessCursor &accesses);
+void runDirtyClock(PageReplacementSimulator &sim, AccessCursor &accesses);
+void runLFU(PageReplacementSimulator &sim, AccessCursor &accesses);
+void runMFU(PageReplacementSimulator &sim, AccessCursor &accesses);
+void runAging(PageReplacementSimulator &sim, AccessCursor &accesses);
+void runARC(PageReplacementSimulator &sim, AccessCursor &accesses);
+void runTwoQ(PageReplacementSimulator &sim, AccessCursor &accesses);
+void runLIRS(PageReplacementSimulator &sim, AccessCursor &accesses);
+void runClockPro(PageReplacementSimulator &sim, AccessCursor &accesses);
+void runWTinyLFU(PageReplacementSimulator &sim, AccessCursor &accesses);
+void runOPT(PageReplacementSimulator &sim, const AccessTrace &trace);
+
+// Algoritmos de reemplazo que compiten en el ranking y en el barrido, en orden de reporte
+const ReplacementAlgorithm REPLACEMENT_ALGORITHMS[] = {
+    ReplacementAlgorithm::FIFO,
+    ReplacementAlgorithm::SecondChance,
+    ReplacementAlgorithm::NRU,
+    ReplacementAlgorithm::LRU,
+    ReplacementAlgorithm::Clock,
+    ReplacementAlgorithm::WSClock,
+    ReplacementAlgorithm::DirtyClock,
+    ReplacementAlgorithm::LFU,
+    ReplacementAlgorithm::MFU,
+    ReplacementAlgorithm::Aging,
+    ReplacementAlgorithm::ARC,
+    ReplacementAlgorithm::TwoQ,
+    ReplacementAlgorithm::LIRS,
+    ReplacementAlgorithm::ClockPro,
+    ReplacementAlgorithm::WTinyLFU,
+    ReplacementAlgorithm::OPT
+};
+
+// Ejecuta el algoritmo indicado en sim.algorithm. Devuelve false si no es un algoritmo de
+// reemplazo (All, MRC, WS, Sweep).
+bool runAlgorithm(PageReplacementSimulator &sim, const AccessTrace &trace);
+
+// Igual, recorriendo los accesos en una sola pasada hacia adelante (por ejemplo, en bloques
+// leídos de un archivo). Devuelve false también para OPT, que necesita conocer el futuro.
+bool runAlgorithm(PageReplacementSimulator &sim, AccessCursor &accesses);
 
 #endif // ALGORITHMS_HPP
@@ -0,0 +1,165 @@
+#include "Checkpoint.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static_assert(sizeof(CheckpointHeader) == 96, "la cabecera del checkpoint no debe tener relleno");
+static_assert(sizeof(CheckpointFrame) == 24, "los marcos del checkpoint no deben tener relleno");
+
+bool supportsCheckpoint(ReplacementAlgorithm algorithm)
+{
+    static const ReplacementAlgorithm SUPPORTED[] = {
+        ReplacementAlgorithm::FIFO,    ReplacementAlgorithm::SecondChance, ReplacementAlgorithm::NRU,
+        ReplacementAlgorithm::LRU,     ReplacementAlgorithm::Clock,        ReplacementAlgorithm::WSClock,
+        ReplacementAlgorithm::DirtyClock, ReplacementAlgorithm::LFU,       ReplacementAlgorithm::MFU,
+        ReplacementAlgorithm::Aging,
+    };
+    return std::find(std::begin(SUPPORTED), std::end(SUPPORTED), algorithm) != std::end(SUPPORTED);
+}
+
+bool saveCheckpoint(const PageReplacementSimulator &sim, const std::string &path)
+{
+    std::ofstream out(path, std::ios::binary);
+    if (!out)
+        return false;
+
+    CheckpointHeader header = {};
+    std::memcpy(header.magic, CHECKPOINT_FILE_MAGIC, sizeof(header.magic));
+    header.version = CHECKPOINT_FILE_VERSION;
+    header.algorithm = static_cast<uint32_t>(sim.algorithm);
+    header.frameCount = sim.frameCount;
+    header.timerInterval = sim.timerInterval;
+    header.agingBits = sim.agingBits;
+    header.workingSetWindow = sim.workingSetWindow;
+    header.clockHand = sim.clockHand;
+    header.globalTime = sim.globalTime;
+    header.pageFaults = sim.pageFaults;
+    header.cleanEvictions = sim.cleanEvictions;
+    header.dirtyEvictions = sim.dirtyEvictions;
+    header.writebacks = sim.writebacks;
+    header.accessCount = sim.accessCount;
+    header.frequencyCount = sim.globalFrequencies.size();
+    header.policyStateCount = sim.policyState.size();
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+    std::vector<CheckpointFrame> frames(sim.frameCount);
+    for (int j = 0; j < sim.frameCount; ++j)
+    {
+        const PageFrame &frame = sim.memory[j];
+        frames[j] = {frame.timestamp, frame.pageNumber, frame.frequency, frame.bits.R, frame.bits.M, frame.bits.V, 0, 0};
+    }
+    out.write(reinterpret_cast<const char *>(frames.data()), frames.size() * sizeof(CheckpointFrame));
+
+    // Ordenada por página, para que el mismo estado dé siempre el mismo archivo
+    std::vector<std::pair<int32_t, int32_t>> frequencies(sim.globalFrequencies.begin(), sim.globalFrequencies.end());
+    std::sort(frequencies.begin(), frequencies.end());
+    for (const auto &entry : frequencies)
+    {
+        int32_t pair[2] = {entry.first, entry.second};
+        out.write(reinterpret_cast<const char *>(pair), sizeof(pair));
+    }
+
+    out.write(reinterpret_cast<const char *>(sim.policyState.data()), sim.policyState.size() * sizeof(int32_t));
+    return static_cast<bool>(out);
+}
+
+// Copia las secciones de un checkpoint ya validado
+static void restoreSections(PageReplacementSimulator &sim, const CheckpointHeader &header, const char *body)
+{
+    sim.timerInterval = header.timerInterval;
+    sim.agingBits = header.agingBits;
+    sim.workingSetWindow = header.workingSetWindow;
+    sim.clockHand = header.clockHand;
+    sim.globalTime = header.globalTime;
+    sim.pageFaults = header.pageFaults;
+    sim.cleanEvictions = header.cleanEvictions;
+    sim.dirtyEvictions = header.dirtyEvictions;
+    sim.writebacks = header.writebacks;
+    sim.accessCount = header.accessCount;
+
+    const auto *frames = reinterpret_cast<const CheckpointFrame *>(body);
+    for (int j = 0; j < sim.frameCount; ++j)
+    {
+        PageFrame &frame = sim.memory[j];
+        frame.pageNumber = frames[j].pageNumber;
+        frame.bits = {frames[j].R != 0, frames[j].M != 0, frames[j].V != 0};
+        frame.timestamp = frames[j].timestamp;
+        frame.frequency = frames[j].frequency;
+    }
+    body += header.frameCount * sizeof(CheckpointFrame);
+
+    const auto *frequencies = reinterpret_cast<const int32_t *>(body);
+    sim.globalFrequencies.clear();
+    for (uint64_t k = 0; k < header.frequencyCount; ++k)
+        sim.globalFrequencies.emplace(frequencies[2 * k], frequencies[2 * k + 1]);
+    body += header.frequencyCount * 2 * sizeof(int32_t);
+
+    const auto *state = reinterpret_cast<const int32_t *>(body);
+    sim.policyState.assign(state, state + header.policyStateCount);
+}
+
+bool restoreCheckpoint(PageReplacementSimulator &sim, const std::string &path)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        std::cerr << "Error: no se pudo abrir el checkpoint: " << path << std::endl;
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(CheckpointHeader))
+    {
+        close(fd);
+        std::cerr << "Error: el archivo no es un checkpoint: " << path << std::endl;
+        return false;
+    }
+
+    size_t bytes = static_cast<size_t>(info.st_size);
+    void *region = mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (region == MAP_FAILED)
+    {
+        std::cerr << "Error: no se pudo proyectar el checkpoint: " << path << std::endl;
+        return false;
+    }
+
+    const auto *header = static_cast<const CheckpointHeader *>(region);
+    bool valid = std::memcmp(header->magic, CHECKPOINT_FILE_MAGIC, sizeof(header->magic)) == 0 &&
+                 header->version == CHECKPOINT_FILE_VERSION;
+    if (valid)
+    {
+        // Las cantidades vienen del archivo: se comparan por separado para no desbordar la suma
+        size_t room = bytes - sizeof(CheckpointHeader);
+        uint64_t frameBytes = static_cast<uint64_t>(std::max(header->frameCount, 0)) * sizeof(CheckpointFrame);
+        valid = header->frameCount >= 0 && frameBytes <= room &&
+                header->frequencyCount <= (room - frameBytes) / (2 * sizeof(int32_t)) &&
+                header->policyStateCount <=
+                    (room - frameBytes - header->frequencyCount * 2 * sizeof(int32_t)) / sizeof(int32_t);
+    }
+    if (!valid)
+    {
+        munmap(region, bytes);
+        std::cerr << "Error: el archivo no es un checkpoint de la versión " << CHECKPOINT_FILE_VERSION << ": "
+                  << path << std::endl;
+        return false;
+    }
+
+    if (header->algorithm != static_cast<uint32_t>(sim.algorithm) || header->frameCount != sim.frameCount)
+    {
+        std::cerr << "Error: el checkpoint es de " << to_string(static_cast<ReplacementAlgorithm>(header->algorithm))
+                  << " con " << header->frameCount << " marcos, no de " << to_string(sim.algorithm) << " con "
+                  << sim.frameCount << " marcos.\n";
+        munmap(region, bytes);
+        return false;
+    }
+
+    restoreSections(sim, *header, static_cast<const char *>(region) + sizeof(CheckpointHeader));
+    munmap(region, bytes);
+    return true;
+}
@@ -0,0 +1,65 @@
+#ifndef CHECKPOINT_HPP
+#define CHECKPOINT_HPP
+
+#include "PageReplacement.hpp"
+#include <cstdint>
+#include <string>
+
+// Cabecera del formato binario de checkpoint. Le siguen, sin relleno entre secciones, los
+// marcos (CheckpointFrame), la historia de frecuencias (pares página, frecuencia de 32 bits)
+// y el estado propio del algoritmo (sim.policyState, enteros de 32 bits).
+struct CheckpointHeader
+{
+    char magic[4];             // "TP2S"
+    uint32_t version;          // CHECKPOINT_FILE_VERSION
+    uint32_t algorithm;        // ReplacementAlgorithm
+    int32_t frameCount;
+    int32_t timerInterval;     // Parámetros de la simulación: al continuar se usan estos
+    int32_t agingBits;
+    int32_t workingSetWindow;
+    int32_t clockHand;
+    int64_t globalTime;        // Tiempo y contadores de 64 bits (versión 2)
+    int64_t pageFaults;
+    int64_t cleanEvictions;
+    int64_t dirtyEvictions;
+    int64_t writebacks;
+    uint64_t accessCount;      // Accesos ya simulados
+    uint64_t frequencyCount;   // Entradas de la historia de frecuencias
+    uint64_t policyStateCount; // Enteros de estado propio del algoritmo
+};
+
+// Un marco en el checkpoint (24 bytes)
+struct CheckpointFrame
+{
+    int64_t timestamp;
+    int32_t pageNumber;
+    int32_t frequency;
+    uint8_t R, M, V, unused;
+    uint32_t reserved;
+};
+
+const char CHECKPOINT_FILE_MAGIC[4] = {'T', 'P', '2', 'S'};
+// 1: contadores y timestamps de 32 bits; 2: de 64 bits
+const uint32_t CHECKPOINT_FILE_VERSION = 2;
+
+// ¿Todo el estado del algoritmo entra en el checkpoint? Los de historia fantasma (ARC, 2Q,
+// LIRS, ClockPro, W-TinyLFU) la guardan en su propio bucle, y OPT necesita la traza completa.
+bool supportsCheckpoint(ReplacementAlgorithm algorithm);
+
+// Guarda el estado del simulador al terminar una simulación; false si no pudo escribirse
+bool saveCheckpoint(const PageReplacementSimulator &sim, const std::string &path);
+
+/**
+ * @brief Restaura el estado guardado con saveCheckpoint para continuar la simulación con
+ *        los accesos que siguen en la traza.
+ *
+ * El archivo se proyecta con mmap y se copia sección por sección a `sim`, que debe tener el
+ * mismo algoritmo y la misma cantidad de marcos. Los contadores siguen acumulando, y el
+ * intervalo del temporizador, los bits de Aging y τ se toman del checkpoint.
+ *
+ * @return false (con el error en std::cerr) si el archivo no es un checkpoint de esta
+ *         versión o no corresponde a `sim`.
+ */
+bool restoreCheckpoint(PageReplacementSimulator &sim, const std::string &path);
+
+#endif // CHECKPOINT_HPP
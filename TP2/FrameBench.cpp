@@ -0,0 +1,97 @@
+// Microbenchmark de la tabla de marcos: compara, para varias cantidades de marcos, las
+// búsquedas por barrido sobre std::vector<PageFrame> (AoS) con las mismas búsquedas sobre
+// las columnas de FrameTable (SoA), en su versión escalar y AVX2.
+//
+//   make bench && ./exec/bench_frames [búsquedas por medición]
+
+#include "FrameTable.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+// Evita que el compilador descarte los resultados de las búsquedas
+static volatile long long sink = 0;
+
+// Nanosegundos por llamada de `search(k)` para k en [0, rounds)
+template <typename Search>
+static double measure(int rounds, Search search)
+{
+    long long total = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int k = 0; k < rounds; ++k)
+        total += search(k);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    sink = sink + total;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / rounds;
+}
+
+static int findAoS(const std::vector<PageFrame> &memory, int page)
+{
+    for (size_t j = 0; j < memory.size(); ++j)
+    {
+        if (memory[j].pageNumber == page)
+            return static_cast<int>(j);
+    }
+    return -1;
+}
+
+// Menor timestamp (LRU por barrido), como lo buscaba el simulador sobre los marcos
+static int oldestAoS(const std::vector<PageFrame> &memory)
+{
+    int best = 0;
+    for (size_t j = 1; j < memory.size(); ++j)
+    {
+        if (memory[j].timestamp < memory[best].timestamp)
+            best = static_cast<int>(j);
+    }
+    return best;
+}
+
+int main(int argc, char *argv[])
+{
+    const int lookups = argc > 1 ? std::atoi(argv[1]) : 200000;
+    const bool avx2 = frameScanSimd();
+    std::mt19937 rng(42);
+
+    std::cout << "Búsquedas por barrido (ns por búsqueda, " << lookups << " por medición; AVX2 "
+              << (avx2 ? "disponible" : "no disponible") << ")\n\n";
+    std::cout << std::setw(8) << "Marcos" << " | " << std::setw(10) << "Página AoS" << std::setw(10) << "SoA"
+              << std::setw(10) << "SoA AVX2" << " | " << std::setw(10) << "Mín. AoS" << std::setw(10) << "SoA"
+              << std::setw(10) << "SoA AVX2" << "\n";
+
+    for (int frames : {16, 64, 256, 1024, 4096, 16384, 65536})
+    {
+        std::vector<PageFrame> memory(frames);
+        for (int j = 0; j < frames; ++j)
+        {
+            memory[j].pageNumber = j * 2; // Páginas pares: la mitad de las búsquedas falla
+            memory[j].timestamp = static_cast<int>(rng() % 1000000);
+            memory[j].frequency = 1;
+        }
+        FrameTable table(memory);
+
+        std::vector<int> pages(4096);
+        for (int &page : pages)
+            page = static_cast<int>(rng() % (2 * frames));
+        const int rounds = std::max(1, static_cast<int>(lookups * 64LL / frames));
+
+        auto page = [&](int k) { return pages[k & 4095]; };
+        double findAos = measure(rounds, [&](int k) { return findAoS(memory, page(k)); });
+        double minAos = measure(rounds, [&](int k) { return oldestAoS(memory) + k; });
+
+        setFrameScanSimd(false);
+        double findScalar = measure(rounds, [&](int k) { return table.find(page(k)); });
+        double minScalar = measure(rounds, [&](int k) { return argMinFrame(table.timestamp.data(), frames) + k; });
+
+        setFrameScanSimd(true);
+        double findSimd = measure(rounds, [&](int k) { return table.find(page(k)); });
+        double minSimd = measure(rounds, [&](int k) { return argMinFrame(table.timestamp.data(), frames) + k; });
+
+        std::cout << std::fixed << std::setprecision(1) << std::setw(8) << frames << " | " << std::setw(10)
+                  << findAos << std::setw(10) << findScalar << std::setw(10) << findSimd << " | " << std::setw(10)
+                  << minAos << std::setw(10) << minScalar << std::setw(10) << minSimd << "\n";
+    }
+    return 0;
+}
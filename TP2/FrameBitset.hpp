@@ -0,0 +1,64 @@
+#ifndef FRAME_BITSET_HPP
+#define FRAME_BITSET_HPP
+
+#include <cstdint>
+#include <vector>
+
+// Conjunto de índices de marcos en un bitset de dos niveles: un bit por marco y un bit
+// resumen por cada palabra no vacía. Buscar el primer marco del conjunto revisa solo
+// las palabras de resumen (marcos / 4096), con find-first-set (ctz) en cada nivel.
+struct FrameBitset
+{
+    std::vector<uint64_t> words;
+    std::vector<uint64_t> summary;
+
+    explicit FrameBitset(int count)
+        : words((count + 63) / 64, 0), summary((words.size() + 63) / 64, 0) {}
+
+    bool test(int i) const { return (words[i >> 6] >> (i & 63)) & 1u; }
+
+    void set(int i)
+    {
+        words[i >> 6] |= uint64_t(1) << (i & 63);
+        summary[i >> 12] |= uint64_t(1) << ((i >> 6) & 63);
+    }
+
+    void reset(int i)
+    {
+        uint64_t &word = words[i >> 6];
+        word &= ~(uint64_t(1) << (i & 63));
+        if (word == 0)
+            summary[i >> 12] &= ~(uint64_t(1) << ((i >> 6) & 63));
+    }
+
+    // Índice más bajo del conjunto, o -1 si está vacío
+    int first() const
+    {
+        for (size_t s = 0; s < summary.size(); ++s)
+        {
+            if (summary[s] != 0)
+            {
+                size_t w = (s << 6) + __builtin_ctzll(summary[s]);
+                return static_cast<int>((w << 6) + __builtin_ctzll(words[w]));
+            }
+        }
+        return -1;
+    }
+
+    // Une `other` a este conjunto y vacía `other` (palabra por palabra)
+    void absorb(FrameBitset &other)
+    {
+        for (size_t w = 0; w < words.size(); ++w)
+        {
+            words[w] |= other.words[w];
+            other.words[w] = 0;
+        }
+        for (size_t s = 0; s < summary.size(); ++s)
+        {
+            summary[s] |= other.summary[s];
+            other.summary[s] = 0;
+        }
+    }
+};
+
+#endif // FRAME_BITSET_HPP
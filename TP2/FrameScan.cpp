@@ -0,0 +1,179 @@
+#include "FrameScan.hpp"
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define FRAME_SCAN_AVX2 1
+#include <immintrin.h>
+#endif
+
+static bool cpuHasAvx2()
+{
+#ifdef FRAME_SCAN_AVX2
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#else
+    return false;
+#endif
+}
+
+static bool useSimd = cpuHasAvx2();
+
+bool frameScanSimd()
+{
+    return useSimd;
+}
+
+void setFrameScanSimd(bool enabled)
+{
+    useSimd = enabled && cpuHasAvx2();
+}
+
+template <typename T>
+static int findScalar(const T *values, int count, T value)
+{
+    for (int i = 0; i < count; ++i)
+    {
+        if (values[i] == value)
+            return i;
+    }
+    return -1;
+}
+
+// Dos pasadas: el mínimo (bucle sin saltos que el compilador vectoriza) y su primera aparición
+template <typename T>
+static int argMinScalar(const T *values, int count)
+{
+    if (count == 0)
+        return -1;
+    T minimum = values[0];
+    for (int i = 1; i < count; ++i)
+        minimum = std::min(minimum, values[i]);
+    return findScalar(values, count, minimum);
+}
+
+#ifdef FRAME_SCAN_AVX2
+
+// Operaciones AVX2 por ancho de columna
+template <typename T>
+struct Avx2Lanes;
+
+template <>
+struct Avx2Lanes<int>
+{
+    __attribute__((target("avx2"))) static __m256i min(__m256i a, __m256i b) { return _mm256_min_epi32(a, b); }
+    __attribute__((target("avx2"))) static __m256i equal(__m256i a, __m256i b) { return _mm256_cmpeq_epi32(a, b); }
+    __attribute__((target("avx2"))) static __m256i broadcast(int v) { return _mm256_set1_epi32(v); }
+};
+
+template <>
+struct Avx2Lanes<uint8_t>
+{
+    __attribute__((target("avx2"))) static __m256i min(__m256i a, __m256i b) { return _mm256_min_epu8(a, b); }
+    __attribute__((target("avx2"))) static __m256i equal(__m256i a, __m256i b) { return _mm256_cmpeq_epi8(a, b); }
+    __attribute__((target("avx2"))) static __m256i broadcast(uint8_t v) { return _mm256_set1_epi8(static_cast<char>(v)); }
+};
+
+template <>
+struct Avx2Lanes<uint16_t>
+{
+    __attribute__((target("avx2"))) static __m256i min(__m256i a, __m256i b) { return _mm256_min_epu16(a, b); }
+    __attribute__((target("avx2"))) static __m256i equal(__m256i a, __m256i b) { return _mm256_cmpeq_epi16(a, b); }
+    __attribute__((target("avx2"))) static __m256i broadcast(uint16_t v) { return _mm256_set1_epi16(static_cast<short>(v)); }
+};
+
+template <>
+struct Avx2Lanes<uint32_t>
+{
+    __attribute__((target("avx2"))) static __m256i min(__m256i a, __m256i b) { return _mm256_min_epu32(a, b); }
+    __attribute__((target("avx2"))) static __m256i equal(__m256i a, __m256i b) { return _mm256_cmpeq_epi32(a, b); }
+    __attribute__((target("avx2"))) static __m256i broadcast(uint32_t v) { return _mm256_set1_epi32(static_cast<int>(v)); }
+};
+
+// AVX2 no tiene mínimo de 64 bits: se arma con la comparación con signo y una mezcla
+template <>
+struct Avx2Lanes<int64_t>
+{
+    __attribute__((target("avx2"))) static __m256i min(__m256i a, __m256i b)
+    {
+        return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b));
+    }
+    __attribute__((target("avx2"))) static __m256i equal(__m256i a, __m256i b) { return _mm256_cmpeq_epi64(a, b); }
+    __attribute__((target("avx2"))) static __m256i broadcast(int64_t v) { return _mm256_set1_epi64x(v); }
+};
+
+template <typename T>
+__attribute__((target("avx2"))) static inline __m256i loadLanes(const T *values)
+{
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values));
+}
+
+// Compara 32 bytes por instrucción; la máscara de bytes iguales da el primer índice (ctz / ancho)
+template <typename T>
+__attribute__((target("avx2"))) static int findAvx2(const T *values, int count, T value)
+{
+    constexpr int lanes = 32 / sizeof(T);
+    const __m256i target = Avx2Lanes<T>::broadcast(value);
+    int i = 0;
+    for (; i + lanes <= count; i += lanes)
+    {
+        unsigned mask = static_cast<unsigned>(
+            _mm256_movemask_epi8(Avx2Lanes<T>::equal(loadLanes(values + i), target)));
+        if (mask != 0)
+            return i + static_cast<int>(__builtin_ctz(mask) / sizeof(T));
+    }
+    for (; i < count; ++i)
+    {
+        if (values[i] == value)
+            return i;
+    }
+    return -1;
+}
+
+template <typename T>
+__attribute__((target("avx2"))) static int argMinAvx2(const T *values, int count)
+{
+    constexpr int lanes = 32 / sizeof(T);
+    if (count < lanes)
+        return argMinScalar(values, count);
+
+    __m256i best = loadLanes(values);
+    int i = lanes;
+    for (; i + lanes <= count; i += lanes)
+        best = Avx2Lanes<T>::min(best, loadLanes(values + i));
+
+    alignas(32) T lane[lanes];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(lane), best);
+    T minimum = lane[0];
+    for (int k = 1; k < lanes; ++k)
+        minimum = std::min(minimum, lane[k]);
+    for (; i < count; ++i)
+        minimum = std::min(minimum, values[i]);
+    return findAvx2(values, count, minimum);
+}
+
+#endif // FRAME_SCAN_AVX2
+
+int findFrame(const int *values, int count, int value)
+{
+#ifdef FRAME_SCAN_AVX2
+    if (useSimd)
+        return findAvx2(values, count, value);
+#endif
+    return findScalar(values, count, value);
+}
+
+template <typename T>
+static int argMin(const T *values, int count)
+{
+#ifdef FRAME_SCAN_AVX2
+    if (useSimd)
+        return argMinAvx2(values, count);
+#endif
+    return argMinScalar(values, count);
+}
+
+int argMinFrame(const int *values, int count) { return argMin(values, count); }
+int argMinFrame(const uint8_t *values, int count) { return argMin(values, count); }
+int argMinFrame(const uint16_t *values, int count) { return argMin(values, count); }
+int argMinFrame(const uint32_t *values, int count) { return argMin(values, count); }
+int argMinFrame(const int64_t *values, int count) { return argMin(values, count); }
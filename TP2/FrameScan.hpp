@@ -0,0 +1,24 @@
+#ifndef FRAME_SCAN_HPP
+#define FRAME_SCAN_HPP
+
+#include <cstdint>
+
+// Búsquedas lineales sobre arreglos contiguos de marcos (una columna de la tabla de marcos).
+// Cada una tiene una versión escalar y otra AVX2 (8 marcos de 32 bits por instrucción); la
+// versión se elige al ejecutar según la CPU, así el binario sigue compilándose sin -mavx2.
+
+// Primer índice con `values[i] == value`, o -1 si no hay
+int findFrame(const int *values, int count, int value);
+
+// Primer índice con el valor mínimo (empates → menor índice), o -1 si `count` es 0
+int argMinFrame(const int *values, int count);
+int argMinFrame(const uint8_t *values, int count);
+int argMinFrame(const uint16_t *values, int count);
+int argMinFrame(const uint32_t *values, int count);
+int argMinFrame(const int64_t *values, int count);
+
+// ¿Se usan las versiones AVX2? Solo si la CPU las soporta; desactivarlas sirve para comparar.
+bool frameScanSimd();
+void setFrameScanSimd(bool enabled);
+
+#endif // FRAME_SCAN_HPP
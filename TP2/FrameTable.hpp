@@ -0,0 +1,90 @@
+#ifndef FRAME_TABLE_HPP
+#define FRAME_TABLE_HPP
+
+#include "PageReplacement.hpp"
+#include "FrameScan.hpp"
+#include <cstdint>
+#include <vector>
+
+// Un bit por marco, empaquetado en palabras de 64 bits
+struct PackedBits
+{
+    std::vector<uint64_t> words;
+
+    explicit PackedBits(int count) : words((count + 63) / 64, 0) {}
+
+    bool test(int i) const { return (words[i >> 6] >> (i & 63)) & 1u; }
+
+    void set(int i, bool value)
+    {
+        uint64_t bit = uint64_t(1) << (i & 63);
+        words[i >> 6] = value ? (words[i >> 6] | bit) : (words[i >> 6] & ~bit);
+    }
+};
+
+/**
+ * @brief Tabla de marcos como estructura de arreglos (SoA).
+ *
+ * Cada campo de PageFrame vive en su propio arreglo contiguo (páginas, timestamps,
+ * frecuencias) y los bits R, M y V van empaquetados. Buscar la página pedida o el menor
+ * valor de una columna recorre solo esa columna, de a 8 marcos con AVX2 (FrameScan), en
+ * vez de arrastrar por la caché los demás campos de cada PageFrame. Se copia de
+ * sim.memory al empezar y se devuelve con store(); mientras tanto las columnas son el
+ * único estado de los marcos.
+ */
+struct FrameTable
+{
+    std::vector<int> page;
+    std::vector<int64_t> timestamp;
+    std::vector<int> frequency;
+    PackedBits R, M, V;
+
+    explicit FrameTable(const std::vector<PageFrame> &memory)
+        : page(memory.size()), timestamp(memory.size()), frequency(memory.size()), R(memory.size()),
+          M(memory.size()), V(memory.size())
+    {
+        for (size_t j = 0; j < memory.size(); ++j)
+        {
+            page[j] = memory[j].pageNumber;
+            timestamp[j] = memory[j].timestamp;
+            frequency[j] = memory[j].frequency;
+            R.set(j, memory[j].bits.R);
+            M.set(j, memory[j].bits.M);
+            V.set(j, memory[j].bits.V);
+        }
+    }
+
+    int size() const { return static_cast<int>(page.size()); }
+
+    // Marco que contiene la página `p`, o -1
+    int find(int p) const { return findFrame(page.data(), size(), p); }
+
+    PageFrame frame(int j) const
+    {
+        PageFrame f;
+        f.pageNumber = page[j];
+        f.bits = {R.test(j), M.test(j), V.test(j)};
+        f.timestamp = timestamp[j];
+        f.frequency = frequency[j];
+        return f;
+    }
+
+    void store(std::vector<PageFrame> &memory) const
+    {
+        for (int j = 0; j < size(); ++j)
+            memory[j] = frame(j);
+    }
+
+    // Carga una página en el marco j (R=1, M según el acceso, V=1) y contabiliza el desalojo
+    // de la que lo ocupaba
+    void load(PageReplacementSimulator &sim, int j, int p, bool modified)
+    {
+        recordEviction(sim, frame(j));
+        page[j] = p;
+        R.set(j, true);
+        M.set(j, modified);
+        V.set(j, true);
+    }
+};
+
+#endif // FRAME_TABLE_HPP
@@ -0,0 +1,281 @@
+#include "HugePages.hpp"
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <sstream>
+#include <unordered_map>
+
+std::string DensityHugePages::name() const
+{
+    std::ostringstream text;
+    text << "Densidad " << density;
+    return text.str();
+}
+
+std::vector<std::unique_ptr<HugePagePolicy>> makeHugePagePolicies(double density)
+{
+    std::vector<std::unique_ptr<HugePagePolicy>> policies;
+    policies.push_back(std::make_unique<NeverHugePages>());
+    policies.push_back(std::make_unique<AlwaysHugePages>());
+    policies.push_back(std::make_unique<DensityHugePages>(density));
+    return policies;
+}
+
+// Unidad mapeada en la lista LRU: una página base o una página grande (por su región)
+struct MappedUnit
+{
+    bool huge = false;
+    int number = 0; // Página base, o región si es grande
+    bool modified = false;
+};
+
+/**
+ * @brief Memoria de páginas base y grandes con una sola lista LRU de unidades mapeadas.
+ *
+ * Las regiones guardan, mientras están mapeadas con una página grande, un bit por página base
+ * usada: es lo que decide la división y lo que se cuenta como memoria inflada.
+ */
+class HugePageMemory
+{
+public:
+    HugePageMemory(int frames, int pageShift, int hugeShift, const HugePagePolicy &policy, const TlbConfig &tlb,
+                   HugePageResult &result)
+        : frames(frames), pageShift(pageShift), hugeShift(hugeShift), hugeBits(hugeShift - pageShift),
+          pages(1 << hugeBits), policy(policy), tlb(tlb, pageShift, pageShift), result(result)
+    {
+    }
+
+    void access(int page, bool modified)
+    {
+        int number = page >> hugeBits;
+        int offset = page & (pages - 1);
+        Region &region = regions[number];
+        region.state.pages = pages;
+
+        if (region.state.huge)
+        {
+            markUsed(region, offset);
+            region.unit->modified = region.unit->modified || modified;
+            lru.splice(lru.begin(), lru, region.unit);
+            tlb.access(page, hugeShift);
+            return;
+        }
+
+        auto it = basePages.find(page);
+        if (it != basePages.end())
+        {
+            it->second->modified = it->second->modified || modified;
+            lru.splice(lru.begin(), lru, it->second);
+            tlb.access(page, pageShift);
+            return;
+        }
+
+        result.faults++;
+        if (pages <= frames && policy.promoteOnFault(region.state))
+        {
+            makeRoom(pages);
+            mapHuge(number, region, modified);
+            markUsed(region, offset);
+            result.hugeFaults++;
+        }
+        else
+        {
+            makeRoom(1);
+            lru.push_front({false, page, modified});
+            basePages[page] = lru.begin();
+            region.state.resident++;
+            used++;
+            if (pages <= frames && policy.promote(region.state))
+                collapse(number, region);
+        }
+        tlb.access(page, region.state.huge ? hugeShift : pageShift);
+    }
+
+    // Cierra la simulación: páginas grandes que siguen cargadas y estadísticas del TLB
+    void finish()
+    {
+        for (const auto &entry : regions)
+        {
+            if (!entry.second.state.huge)
+                continue;
+            result.finalHugePages++;
+            result.unusedPages += pages - entry.second.state.touched;
+        }
+        result.tlb = tlb.stats();
+    }
+
+private:
+    struct Region
+    {
+        RegionState state;
+        std::vector<uint64_t> usedBits;          // Páginas base usadas (solo si es grande)
+        std::list<MappedUnit>::iterator unit;    // Su unidad en la lista LRU (solo si es grande)
+    };
+
+    void markUsed(Region &region, int offset)
+    {
+        uint64_t &word = region.usedBits[offset >> 6];
+        uint64_t bit = uint64_t(1) << (offset & 63);
+        if (!(word & bit))
+        {
+            word |= bit;
+            region.state.touched++;
+        }
+    }
+
+    void mapHuge(int number, Region &region, bool modified)
+    {
+        lru.push_front({true, number, modified});
+        region.unit = lru.begin();
+        region.usedBits.assign((pages + 63) / 64, 0);
+        region.state.touched = 0;
+        region.state.huge = true;
+        used += pages;
+    }
+
+    // Promoción: las páginas base de la región se reemplazan por una página grande. Las ya
+    // cargadas cuentan como usadas y su bit M pasa a la página grande.
+    void collapse(int number, Region &region)
+    {
+        int first = number * pages;
+        bool modified = false;
+        std::vector<int> loaded;
+        for (int offset = 0; offset < pages; ++offset)
+        {
+            auto it = basePages.find(first + offset);
+            if (it == basePages.end())
+                continue;
+            modified = modified || it->second->modified;
+            lru.erase(it->second);
+            basePages.erase(it);
+            tlb.invalidate(first + offset, pageShift);
+            loaded.push_back(offset);
+        }
+        used -= region.state.resident;
+        region.state.resident = 0;
+
+        makeRoom(pages);
+        mapHuge(number, region, modified);
+        for (int offset : loaded)
+            markUsed(region, offset);
+        result.promotions++;
+    }
+
+    // Desaloja desde la cola LRU hasta que haya `needed` marcos libres. Una página grande se
+    // divide si la política lo pide (sus páginas base usadas siguen en la cola) o se desaloja.
+    void makeRoom(int needed)
+    {
+        while (frames - used < needed)
+        {
+            MappedUnit victim = lru.back();
+            lru.pop_back();
+            if (!victim.huge)
+            {
+                basePages.erase(victim.number);
+                tlb.invalidate(victim.number, pageShift);
+                regions[victim.number >> hugeBits].state.resident--;
+                if (victim.modified)
+                    result.writebacks++;
+                used--;
+                continue;
+            }
+
+            Region &region = regions[victim.number];
+            tlb.invalidate(victim.number * pages, hugeShift);
+            used -= pages;
+            result.unusedPages += pages - region.state.touched;
+            if (policy.demote(region.state))
+            {
+                result.demotions++;
+                int first = victim.number * pages;
+                for (int offset = 0; offset < pages; ++offset)
+                {
+                    if (!((region.usedBits[offset >> 6] >> (offset & 63)) & 1))
+                        continue;
+                    lru.push_back({false, first + offset, victim.modified});
+                    basePages[first + offset] = std::prev(lru.end());
+                    region.state.resident++;
+                    used++;
+                }
+            }
+            else if (victim.modified)
+            {
+                result.writebacks += pages;
+            }
+            region.state.huge = false;
+            region.state.touched = 0;
+            region.usedBits.clear();
+        }
+    }
+
+    int frames;
+    int pageShift;
+    int hugeShift;
+    int hugeBits;
+    int pages; // Páginas base por página grande
+    int used = 0;
+    const HugePagePolicy &policy;
+    TranslationBuffer tlb;
+    HugePageResult &result;
+    std::list<MappedUnit> lru; // Más reciente al frente
+    std::unordered_map<int, std::list<MappedUnit>::iterator> basePages;
+    std::unordered_map<int, Region> regions;
+};
+
+HugePageResult runHugePages(const AccessTrace &trace, int frames, int pageShift, int hugeShift,
+                            const HugePagePolicy &policy, const TlbConfig &tlb)
+{
+    if (hugeShift <= pageShift || hugeShift - pageShift > 30)
+    {
+        std::cerr << "Error: la página grande debe ser mayor que la página base y como mucho 2^30 veces ella.\n";
+        std::exit(EXIT_FAILURE);
+    }
+
+    HugePageResult result;
+    result.policy = policy.name();
+    HugePageMemory memory(frames, pageShift, hugeShift, policy, tlb, result);
+    for (size_t i = 0; i < trace.size(); ++i)
+        memory.access(trace.page(i), trace.modified(i));
+    memory.finish();
+    return result;
+}
+
+void printHugePages(const std::vector<HugePageResult> &results, int frames, int pageShift, int hugeShift,
+                    const TlbConfig &tlb, size_t accessCount)
+{
+    std::cout << "\n=== Páginas grandes (" << frames << " marcos de " << pageSizeLabel(pageShift)
+              << ", páginas grandes de " << pageSizeLabel(hugeShift) << " = " << (1LL << (hugeShift - pageShift))
+              << " páginas base) ===\n";
+    std::cout << std::left << std::setw(14) << "Política" << std::right << std::setw(10) << "Fallos" << std::setw(16)
+              << "Tasa de fallos" << std::setw(16) << "Fallos grandes" << std::setw(13) << "Promociones"
+              << std::setw(12) << "Divisiones" << std::setw(12) << "Escrituras" << std::setw(10) << "Sin usar"
+              << "\n";
+    for (const auto &result : results)
+    {
+        double rate = accessCount ? static_cast<double>(result.faults) / accessCount : 0.0;
+        std::cout << std::left << std::setw(14) << result.policy << std::right << std::setw(10) << result.faults
+                  << std::setw(16) << std::fixed << std::setprecision(4) << rate << std::defaultfloat
+                  << std::setw(16) << result.hugeFaults << std::setw(13) << result.promotions << std::setw(12)
+                  << result.demotions << std::setw(12) << result.writebacks << std::setw(10) << result.unusedPages
+                  << "\n";
+    }
+
+    std::cout << "\n--- TLB (" << tlb.entries << " entradas, " << tlb.ways << " vías, " << to_string(tlb.policy)
+              << "; acierto " << tlb.hitCycles << " ciclos, " << tlb.levelCycles << " ciclos por nivel) ---\n";
+    std::cout << std::left << std::setw(14) << "Política" << std::right << std::setw(18) << "Grandes al final"
+              << std::setw(12) << "Fallos TLB" << std::setw(16) << "Tasa de fallos" << std::setw(18)
+              << "Refs/caminata" << std::setw(16) << "Ciclos/acceso" << "\n";
+    for (const auto &result : results)
+    {
+        const TlbStats &row = result.tlb;
+        double missRate = row.accesses ? static_cast<double>(row.misses) / row.accesses : 0.0;
+        double refsPerWalk = row.misses ? static_cast<double>(row.walkRefs) / row.misses : 0.0;
+        std::cout << std::left << std::setw(14) << result.policy << std::right << std::setw(18)
+                  << result.finalHugePages << std::setw(12) << row.misses << std::fixed << std::setprecision(4)
+                  << std::setw(16) << missRate << std::setprecision(2) << std::setw(18) << refsPerWalk
+                  << std::setw(16) << row.cyclesPerAccess << std::defaultfloat << "\n";
+    }
+}
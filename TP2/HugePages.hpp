@@ -0,0 +1,124 @@
+#ifndef HUGE_PAGES_HPP
+#define HUGE_PAGES_HPP
+
+#include "AccessTrace.hpp"
+#include "Tlb.hpp"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Tamaño de página grande por defecto (2 MiB, como las transparent huge pages de x86-64)
+const int DEFAULT_HUGE_PAGE_SHIFT = 21;
+
+// Fracción de páginas base de una región que deben estar cargadas para promoverla
+const double DEFAULT_PROMOTION_DENSITY = 0.5;
+
+// Estado de una región alineada del tamaño de una página grande, visto por la política
+struct RegionState
+{
+    int pages = 0;     // Páginas base por región
+    int resident = 0;  // Páginas base cargadas (0 si la región está mapeada con una página grande)
+    int touched = 0;   // Páginas base usadas (o ya cargadas) desde que es una página grande
+    bool huge = false; // ¿Está mapeada con una página grande?
+};
+
+/**
+ * @brief Política de promoción y degradación de páginas grandes.
+ *
+ * El simulador la consulta en tres momentos: en un fallo sobre una región sin páginas
+ * cargadas (¿se asigna directamente una página grande?), después de cargar una página base
+ * (¿se colapsa la región en una página grande?) y cuando la página grande usada hace más
+ * tiempo debe liberar marcos (¿se divide, conservando solo las páginas base usadas, o se
+ * desaloja entera?).
+ */
+class HugePagePolicy
+{
+public:
+    virtual ~HugePagePolicy() = default;
+
+    virtual std::string name() const = 0;
+    virtual bool promoteOnFault(const RegionState &region) const = 0;
+    virtual bool promote(const RegionState &region) const = 0;
+    virtual bool demote(const RegionState &region) const = 0;
+};
+
+// Sin páginas grandes (THP desactivado): la referencia con la que se comparan las demás
+class NeverHugePages : public HugePagePolicy
+{
+public:
+    std::string name() const override { return "Nunca"; }
+    bool promoteOnFault(const RegionState &) const override { return false; }
+    bool promote(const RegionState &) const override { return false; }
+    bool demote(const RegionState &) const override { return false; }
+};
+
+// Como THP "always": el primer fallo de una región asigna la página grande completa y,
+// bajo presión, se divide si tiene páginas base sin usar
+class AlwaysHugePages : public HugePagePolicy
+{
+public:
+    std::string name() const override { return "Siempre"; }
+    bool promoteOnFault(const RegionState &region) const override { return region.resident == 0; }
+    bool promote(const RegionState &) const override { return false; }
+    bool demote(const RegionState &region) const override { return region.touched < region.pages; }
+};
+
+// Como khugepaged: la región se colapsa cuando al menos `density` de sus páginas base están
+// cargadas, y bajo presión se divide si menos de esa fracción se usó desde la promoción
+class DensityHugePages : public HugePagePolicy
+{
+public:
+    explicit DensityHugePages(double density) : density(density) {}
+
+    std::string name() const override;
+    bool promoteOnFault(const RegionState &) const override { return false; }
+    bool promote(const RegionState &region) const override { return region.resident >= density * region.pages; }
+    bool demote(const RegionState &region) const override { return region.touched < density * region.pages; }
+
+private:
+    double density;
+};
+
+// Políticas que se comparan en el modo THP, en orden de reporte
+std::vector<std::unique_ptr<HugePagePolicy>> makeHugePagePolicies(double density);
+
+// Resultado de una política sobre toda la traza
+struct HugePageResult
+{
+    std::string policy;
+    int64_t faults = 0;
+    int64_t hugeFaults = 0;      // Fallos resueltos asignando una página grande
+    int64_t promotions = 0;      // Regiones colapsadas en una página grande
+    int64_t demotions = 0;       // Páginas grandes divididas bajo presión
+    long long writebacks = 0;    // Páginas base escritas a disco
+    long long unusedPages = 0;   // Páginas base cargadas en páginas grandes que nunca se usaron
+    int finalHugePages = 0;      // Páginas grandes cargadas al terminar
+    TlbStats tlb;
+};
+
+/**
+ * @brief Simula memoria con páginas base y páginas grandes bajo una política de promoción.
+ *
+ * La memoria tiene `frames` marcos de páginas base; una página grande ocupa 2^(hugeShift -
+ * pageShift) marcos contiguos. El reemplazo es LRU sobre las unidades mapeadas (páginas base
+ * y páginas grandes). Una página grande modificada escribe todas sus páginas base al
+ * desalojarse; al dividirse, sus páginas base usadas quedan en su posición LRU con el bit M
+ * de la página grande y las no usadas se liberan sin escribirse. Cada acceso se traduce en un
+ * TLB con entradas de ambos tamaños, que se invalidan al desalojar, dividir o colapsar.
+ *
+ * @param trace     Secuencia de accesos en páginas base.
+ * @param frames    Marcos de páginas base.
+ * @param pageShift Log2 del tamaño de página base.
+ * @param hugeShift Log2 del tamaño de página grande (> pageShift).
+ * @param policy    Política de promoción y degradación.
+ * @param tlb       Geometría y costos del TLB.
+ */
+HugePageResult runHugePages(const AccessTrace &trace, int frames, int pageShift, int hugeShift,
+                            const HugePagePolicy &policy, const TlbConfig &tlb);
+
+// Imprime la comparación de políticas: fallos, promociones, escrituras, páginas sin usar y TLB
+void printHugePages(const std::vector<HugePageResult> &results, int frames, int pageShift, int hugeShift,
+                    const TlbConfig &tlb, size_t accessCount);
+
+#endif // HUGE_PAGES_HPP
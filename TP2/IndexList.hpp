@@ -0,0 +1,83 @@
+#ifndef INDEX_LIST_HPP
+#define INDEX_LIST_HPP
+
+#include <vector>
+
+// Enlaces de una lista doblemente enlazada intrusiva sobre índices (marcos o nodos).
+// Varias listas pueden compartir los mismos enlaces siempre que cada índice
+// pertenezca a lo sumo a una lista a la vez. No hay asignaciones por acceso.
+struct IndexLinks
+{
+    std::vector<int> prev;
+    std::vector<int> next;
+
+    explicit IndexLinks(int count) : prev(count, -1), next(count, -1) {}
+};
+
+// Lista doblemente enlazada de índices con inserción, borrado y movimiento en O(1)
+struct IndexList
+{
+    IndexLinks *links;
+    int head = -1; // Primer índice (-1 si está vacía)
+    int tail = -1; // Último índice (-1 si está vacía)
+    int size = 0;
+
+    explicit IndexList(IndexLinks &l) : links(&l) {}
+
+    bool empty() const { return size == 0; }
+
+    // Inserta `i` justo después de `pos` (si pos == -1, al inicio de la lista)
+    void insertAfter(int pos, int i)
+    {
+        int after = (pos == -1) ? head : links->next[pos];
+        links->prev[i] = pos;
+        links->next[i] = after;
+        if (pos == -1)
+            head = i;
+        else
+            links->next[pos] = i;
+        if (after == -1)
+            tail = i;
+        else
+            links->prev[after] = i;
+        size++;
+    }
+
+    void pushFront(int i) { insertAfter(-1, i); }
+    void pushBack(int i) { insertAfter(tail, i); }
+
+    // Desenlaza `i`, que debe pertenecer a esta lista
+    void remove(int i)
+    {
+        int p = links->prev[i];
+        int n = links->next[i];
+        if (p == -1)
+            head = n;
+        else
+            links->next[p] = n;
+        if (n == -1)
+            tail = p;
+        else
+            links->prev[n] = p;
+        links->prev[i] = links->next[i] = -1;
+        size--;
+    }
+
+    int popFront()
+    {
+        int i = head;
+        remove(i);
+        return i;
+    }
+
+    void moveToBack(int i)
+    {
+        if (i != tail)
+        {
+            remove(i);
+            pushBack(i);
+        }
+    }
+};
+
+#endif // INDEX_LIST_HPP
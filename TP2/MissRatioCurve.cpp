@@ -0,0 +1,165 @@
+#include "MissRatioCurve.hpp"
+#include <iostream>
+#include <iomanip>
+#include <unordered_map>
+#include <algorithm>
+
+/**
+ * @brief Árbol de Fenwick (BIT) sobre posiciones de la secuencia de accesos.
+ *
+ * Cada posición vale 1 si es el último acceso conocido de alguna página, de modo que la
+ * suma de un rango cuenta páginas distintas accedidas en ese intervalo.
+ */
+struct FenwickTree
+{
+    std::vector<int> tree;
+
+    explicit FenwickTree(size_t n) : tree(n + 1, 0) {}
+
+    void add(size_t pos, int delta)
+    {
+        for (size_t i = pos + 1; i < tree.size(); i += i & (~i + 1))
+            tree[i] += delta;
+    }
+
+    // Suma de las posiciones [0, pos)
+    int prefix(size_t pos) const
+    {
+        int sum = 0;
+        for (size_t i = pos; i > 0; i -= i & (~i + 1))
+            sum += tree[i];
+        return sum;
+    }
+};
+
+// Estado por página durante la pasada
+struct StackEntry
+{
+    size_t lastAccess = 0;   // Posición del último acceso
+    bool written = false;    // ¿Hubo alguna escritura?
+    int maxSinceWrite = 0;   // Mayor distancia de pila desde la última escritura
+};
+
+/**
+ * @brief Calcula la curva de fallos LRU para toda cantidad de marcos en una pasada.
+ *
+ * La distancia de pila d de un acceso es la cantidad de páginas distintas usadas desde el
+ * acceso anterior a la misma página (incluyéndola). Con F marcos, LRU acierta si d <= F,
+ * así que un histograma de distancias da los fallos de todas las F a la vez (O(n log n)).
+ *
+ * Escrituras sucias: si d > F la página fue reemplazada entre sus dos accesos. Estaba
+ * modificada si hubo una escritura desde que se cargó, es decir, si ningún acceso posterior
+ * a la última escritura falló con F marcos (F >= maxSinceWrite). Cada reemplazo suma 1
+ * a las F en [maxSinceWrite, d - 1], acumulado con un arreglo de diferencias. Al final,
+ * las páginas que no se vuelven a usar se tratan igual con su profundidad en la pila.
+ *
+ * @param trace Secuencia de accesos empaquetados (página y bit M por palabra).
+ * @return Un punto por cada cantidad de marcos entre 1 y la cantidad de páginas distintas.
+ */
+std::vector<MissRatioPoint> computeLRUMissRatioCurve(const AccessTrace &trace)
+{
+    FenwickTree marks(trace.size());
+    std::unordered_map<int, StackEntry> entries;
+    std::vector<long long> distanceCount(2, 0); // distanceCount[d] = accesos con distancia d
+    std::vector<long long> dirtyDelta(2, 0);    // Diferencias de escrituras sucias por F
+    long long coldMisses = 0;
+
+    for (size_t i = 0; i < trace.size(); ++i)
+    {
+        bool modified = trace.modified(i);
+        auto it = entries.find(trace.page(i));
+
+        if (it == entries.end())
+        {
+            // Primer acceso: fallo obligatorio para cualquier cantidad de marcos
+            coldMisses++;
+            entries.emplace(trace.page(i), StackEntry{i, modified, 0});
+            marks.add(i, 1);
+            continue;
+        }
+
+        StackEntry &entry = it->second;
+        int distance = marks.prefix(i) - marks.prefix(entry.lastAccess);
+
+        if (static_cast<size_t>(distance) + 1 >= distanceCount.size())
+        {
+            distanceCount.resize(distance + 2, 0);
+            dirtyDelta.resize(distance + 2, 0);
+        }
+        distanceCount[distance]++;
+
+        // Reemplazo con página modificada para F en [max(1, maxSinceWrite), distance - 1]
+        int low = std::max(1, entry.maxSinceWrite);
+        if (entry.written && low <= distance - 1)
+        {
+            dirtyDelta[low]++;
+            dirtyDelta[distance]--;
+        }
+
+        if (modified)
+        {
+            entry.written = true;
+            entry.maxSinceWrite = 0;
+        }
+        else
+        {
+            entry.maxSinceWrite = std::max(entry.maxSinceWrite, distance);
+        }
+
+        marks.add(entry.lastAccess, -1);
+        marks.add(i, 1);
+        entry.lastAccess = i;
+    }
+
+    // Páginas que no se vuelven a usar: fueron reemplazadas si su profundidad final supera F
+    for (const auto &item : entries)
+    {
+        const StackEntry &entry = item.second;
+        int depth = marks.prefix(trace.size()) - marks.prefix(entry.lastAccess);
+        int low = std::max(1, entry.maxSinceWrite);
+        if (entry.written && low <= depth - 1)
+        {
+            if (static_cast<size_t>(depth) >= dirtyDelta.size())
+                dirtyDelta.resize(depth + 1, 0);
+            dirtyDelta[low]++;
+            dirtyDelta[depth]--;
+        }
+    }
+
+    // Fallos(F) = fallos obligatorios + accesos con distancia mayor que F
+    int distinctPages = static_cast<int>(entries.size());
+    std::vector<MissRatioPoint> curve(distinctPages);
+    long long farther = 0;
+    for (size_t d = 2; d < distanceCount.size(); ++d)
+        farther += distanceCount[d];
+
+    long long dirty = 0;
+    for (int frames = 1; frames <= distinctPages; ++frames)
+    {
+        if (static_cast<size_t>(frames) < dirtyDelta.size())
+            dirty += dirtyDelta[frames];
+
+        curve[frames - 1] = {frames, coldMisses + farther, dirty};
+
+        if (static_cast<size_t>(frames) + 1 < distanceCount.size())
+            farther -= distanceCount[frames + 1];
+    }
+
+    return curve;
+}
+
+// Imprime la curva de fallos como tabla
+void printMissRatioCurve(const std::vector<MissRatioPoint> &curve, size_t accessCount)
+{
+    std::cout << "\n=== Curva de fallos LRU (memoria inicial vacía) ===\n";
+    std::cout << std::setw(8) << "Marcos" << std::setw(10) << "Fallos"
+              << std::setw(16) << "Tasa de fallos" << std::setw(20) << "Escrituras sucias" << "\n";
+
+    for (const auto &point : curve)
+    {
+        double ratio = accessCount ? static_cast<double>(point.faults) / accessCount : 0.0;
+        std::cout << std::setw(8) << point.frames << std::setw(10) << point.faults
+                  << std::setw(16) << std::fixed << std::setprecision(4) << ratio
+                  << std::setw(20) << point.dirtyEvictions << "\n";
+    }
+}
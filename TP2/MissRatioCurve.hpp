@@ -0,0 +1,24 @@
+#ifndef MISS_RATIO_CURVE_HPP
+#define MISS_RATIO_CURVE_HPP
+
+#include "AccessTrace.hpp"
+#include <vector>
+#include <cstddef>
+
+// Resultado de LRU para una cantidad de marcos dada
+struct MissRatioPoint
+{
+    int frames = 0;                // Cantidad de marcos
+    long long faults = 0;          // Fallos de página con LRU
+    long long dirtyEvictions = 0;  // Reemplazos de páginas con M=1 (escrituras a disco)
+};
+
+// Calcula la curva de fallos LRU para todas las cantidades de marcos 1..N
+// (N = páginas distintas) en una sola pasada de distancias de pila de Mattson.
+// La memoria inicial se asume vacía.
+std::vector<MissRatioPoint> computeLRUMissRatioCurve(const AccessTrace &trace);
+
+// Imprime la curva como tabla: marcos, fallos, tasa de fallos y escrituras sucias
+void printMissRatioCurve(const std::vector<MissRatioPoint> &curve, size_t accessCount);
+
+#endif // MISS_RATIO_CURVE_HPP
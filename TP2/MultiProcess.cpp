@@ -0,0 +1,400 @@
+#include "MultiProcess.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+
+void ProcessTokenizer::feed(const char *text, size_t length, ProcessTrace &out)
+{
+    for (size_t i = 0; i < length; ++i)
+    {
+        char c = text[i];
+        if (c == ',')
+            emit(out);
+        else if (!std::isspace(static_cast<unsigned char>(c)) && c != '[' && c != ']')
+            token += c;
+    }
+}
+
+void ProcessTokenizer::finish(ProcessTrace &out)
+{
+    if (!token.empty())
+        emit(out);
+}
+
+// Convierte un token como "1:5" o "1:5*" en un acceso; termina el programa si es inválido
+void ProcessTokenizer::emit(ProcessTrace &out)
+{
+    bool modified = false;
+    if (!token.empty() && token.back() == '*')
+    {
+        modified = true;
+        token.pop_back();
+    }
+
+    try
+    {
+        int pid = 0;
+        size_t colon = token.find(':');
+        if (colon != std::string::npos)
+            pid = std::stoi(token.substr(0, colon));
+        std::string pageText = colon == std::string::npos ? token : token.substr(colon + 1);
+        size_t used = 0;
+        int page = std::stoi(pageText, &used);
+        if (used != pageText.size() || page < MIN_TRACE_PAGE || page > MAX_TRACE_PAGE)
+            throw std::out_of_range(token);
+        out.accesses.push(page, modified);
+        out.pids.push_back(pid);
+    }
+    catch (...)
+    {
+        std::cerr << "Error: entrada inválida en secuencia: " << token << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+    token.clear();
+}
+
+void parseProcessTrace(const std::string &input, ProcessTrace &trace)
+{
+    ProcessTokenizer tokenizer;
+    tokenizer.feed(input.data(), input.size(), trace);
+    tokenizer.finish(trace);
+}
+
+void loadProcessTrace(const std::string &path, ProcessTrace &trace)
+{
+    std::ifstream in(path);
+    if (!in)
+    {
+        std::cerr << "Error: no se pudo abrir el archivo de traza: " << path << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+
+    ProcessTokenizer tokenizer;
+    std::vector<char> block(TEXT_BLOCK_BYTES);
+    while (in.read(block.data(), block.size()) || in.gcount() > 0)
+        tokenizer.feed(block.data(), static_cast<size_t>(in.gcount()), trace);
+    tokenizer.finish(trace);
+}
+
+std::string to_string(FrameAllocation allocation)
+{
+    switch (allocation)
+    {
+        case FrameAllocation::Global: return "Global";
+        case FrameAllocation::LocalFixed: return "Local fija";
+        case FrameAllocation::PFF: return "Local PFF";
+    }
+    return "Desconocida";
+}
+
+// Marco de la memoria compartida, enlazado en la lista LRU de su proceso
+struct SharedFrame
+{
+    int owner = -1; // Índice del proceso dueño (-1 = libre)
+    int page = 0;
+    bool modified = false;
+    size_t lastUse = 0;
+    int prev = -1; // Hacia la página más reciente
+    int next = -1; // Hacia la página más antigua
+};
+
+// Resultado de un acceso: acierto, primer uso de la página o fallo sobre una página que
+// ya estuvo cargada y fue desalojada
+enum class AccessOutcome
+{
+    Hit,
+    ColdFault,
+    Refault
+};
+
+// Tabla de páginas, lista LRU y contadores de un proceso
+struct ProcessState
+{
+    std::unordered_map<int, int> pageTable; // Página -> marco
+    std::unordered_set<int> seen;           // Páginas cargadas alguna vez
+    int head = -1;                          // Página más reciente
+    int tail = -1;                          // Página más antigua
+    int resident = 0;
+    int quota = 0;
+    size_t windowAccesses = 0;
+    int windowFaults = 0;
+    int windowRefaults = 0;
+    ProcessStats stats;
+};
+
+/**
+ * @brief Memoria física compartida por varios procesos con listas LRU por proceso.
+ *
+ * El reemplazo global elige la cola LRU más antigua entre todos los procesos (O(procesos)
+ * por fallo); el local, la del propio proceso o la de uno que excede su cuota.
+ */
+class SharedMemory
+{
+public:
+    SharedMemory(int frames, size_t processCount) : memory(frames), processes(processCount)
+    {
+        for (int f = frames - 1; f >= 0; --f)
+            freeFrames.push_back(f);
+    }
+
+    std::vector<ProcessState> &states() { return processes; }
+    int64_t writebacks() const { return writebackCount; }
+
+    // Accede a `page` del proceso p
+    AccessOutcome access(int p, int page, bool modified, size_t time, bool global)
+    {
+        ProcessState &proc = processes[p];
+        auto it = proc.pageTable.find(page);
+        int f;
+        AccessOutcome outcome = AccessOutcome::Hit;
+        if (it != proc.pageTable.end())
+        {
+            f = it->second;
+            unlink(proc, f);
+        }
+        else
+        {
+            outcome = proc.seen.insert(page).second ? AccessOutcome::ColdFault : AccessOutcome::Refault;
+            f = takeFrame(p, global);
+            memory[f].owner = p;
+            memory[f].page = page;
+            memory[f].modified = false;
+            proc.pageTable.emplace(page, f);
+            proc.resident++;
+            proc.stats.maxFrames = std::max(proc.stats.maxFrames, proc.resident);
+        }
+
+        memory[f].modified = memory[f].modified || modified;
+        memory[f].lastUse = time;
+        pushFront(proc, f);
+        return outcome;
+    }
+
+private:
+    int takeFrame(int p, bool global)
+    {
+        ProcessState &proc = processes[p];
+        bool underQuota = global || proc.resident < proc.quota;
+        if (underQuota && !freeFrames.empty())
+        {
+            int f = freeFrames.back();
+            freeFrames.pop_back();
+            return f;
+        }
+
+        // Local: el proceso que ya ocupa su cuota reemplaza una de sus propias páginas
+        if (!global && !underQuota && proc.tail != -1)
+            return evict(proc.tail);
+
+        // Global (o local bajo la cuota): la página más antigua de los candidatos
+        int victim = -1;
+        for (const auto &other : processes)
+        {
+            if (other.tail == -1 || (!global && other.resident <= other.quota))
+                continue;
+            if (victim == -1 || memory[other.tail].lastUse < memory[victim].lastUse)
+                victim = other.tail;
+        }
+        if (victim == -1)
+            victim = proc.tail != -1 ? proc.tail : 0;
+        return evict(victim);
+    }
+
+    // Libera el marco f de su dueño y lo devuelve para reutilizarlo
+    int evict(int f)
+    {
+        ProcessState &owner = processes[memory[f].owner];
+        if (memory[f].modified)
+            writebackCount++;
+        unlink(owner, f);
+        owner.pageTable.erase(memory[f].page);
+        owner.resident--;
+        memory[f].owner = -1;
+        return f;
+    }
+
+    void unlink(ProcessState &proc, int f)
+    {
+        SharedFrame &frame = memory[f];
+        if (frame.prev != -1)
+            memory[frame.prev].next = frame.next;
+        else
+            proc.head = frame.next;
+        if (frame.next != -1)
+            memory[frame.next].prev = frame.prev;
+        else
+            proc.tail = frame.prev;
+        frame.prev = frame.next = -1;
+    }
+
+    void pushFront(ProcessState &proc, int f)
+    {
+        memory[f].prev = -1;
+        memory[f].next = proc.head;
+        if (proc.head != -1)
+            memory[proc.head].prev = f;
+        proc.head = f;
+        if (proc.tail == -1)
+            proc.tail = f;
+    }
+
+    std::vector<SharedFrame> memory;
+    std::vector<int> freeFrames;
+    std::vector<ProcessState> processes;
+    int64_t writebackCount = 0;
+};
+
+MultiProcessResult runMultiProcess(const ProcessTrace &trace, int frames, FrameAllocation allocation, int window)
+{
+    MultiProcessResult result;
+    result.allocation = allocation;
+
+    // Procesos en orden de primera aparición
+    std::unordered_map<int, int> index;
+    std::vector<int> pids;
+    for (int pid : trace.pids)
+    {
+        if (index.emplace(pid, static_cast<int>(pids.size())).second)
+            pids.push_back(pid);
+    }
+
+    bool global = allocation == FrameAllocation::Global;
+    if (!global && frames < static_cast<int>(pids.size()))
+    {
+        std::cerr << "Error: la asignación local necesita al menos un marco por proceso ("
+                  << pids.size() << " procesos, " << frames << " marcos).\n";
+        std::exit(EXIT_FAILURE);
+    }
+
+    SharedMemory memory(frames, pids.size());
+    auto &procs = memory.states();
+    for (size_t p = 0; p < procs.size(); ++p)
+    {
+        procs[p].stats.pid = pids[p];
+        int share = frames / static_cast<int>(pids.size());
+        int remainder = frames % static_cast<int>(pids.size());
+        procs[p].quota = share + (static_cast<int>(p) < remainder ? 1 : 0);
+    }
+    int spare = 0; // Marcos cedidos por PFF que ningún proceso tomó todavía
+
+    size_t windowAccesses = 0;
+    int windowRefaults = 0;
+    for (size_t i = 0; i < trace.accesses.size(); ++i)
+    {
+        int p = index[trace.pids[i]];
+        AccessOutcome outcome = memory.access(p, trace.accesses.page(i), trace.accesses.modified(i), i + 1, global);
+
+        ProcessState &proc = procs[p];
+        proc.stats.accesses++;
+        proc.windowAccesses++;
+        windowAccesses++;
+        if (outcome != AccessOutcome::Hit)
+        {
+            proc.stats.faults++;
+            proc.windowFaults++;
+            result.faults++;
+        }
+        if (outcome == AccessOutcome::Refault)
+        {
+            proc.windowRefaults++;
+            windowRefaults++;
+        }
+
+        if (window <= 0 || windowAccesses < static_cast<size_t>(window))
+            continue;
+
+        // Fin de ventana: ajuste de PFF con la tasa de fallos y detección de thrashing con la
+        // de refallos (los fallos obligatorios del arranque no son thrashing)
+        std::vector<std::pair<double, int>> growing;
+        for (size_t q = 0; q < procs.size(); ++q)
+        {
+            ProcessState &state = procs[q];
+            double rate = state.windowAccesses ? static_cast<double>(state.windowFaults) / state.windowAccesses : 0.0;
+            if (state.windowAccesses > 0 &&
+                static_cast<double>(state.windowRefaults) / state.windowAccesses > PFF_UPPER_RATE)
+                state.stats.thrashingWindows++;
+            if (allocation == FrameAllocation::PFF)
+            {
+                if (rate > PFF_UPPER_RATE)
+                    growing.push_back({rate, static_cast<int>(q)});
+                else if (rate < PFF_LOWER_RATE && state.quota > 1)
+                {
+                    state.quota--;
+                    spare++;
+                }
+            }
+            state.windowAccesses = 0;
+            state.windowFaults = 0;
+            state.windowRefaults = 0;
+        }
+
+        std::sort(growing.begin(), growing.end(), [](auto &a, auto &b) { return a.first > b.first; });
+        for (const auto &item : growing)
+        {
+            if (spare == 0)
+                break;
+            procs[item.second].quota++;
+            spare--;
+        }
+
+        result.windows++;
+        if (static_cast<double>(windowRefaults) / windowAccesses > PFF_UPPER_RATE)
+        {
+            if (result.thrashingWindows == 0)
+                result.firstThrashing = i + 1;
+            result.thrashingWindows++;
+        }
+        windowAccesses = 0;
+        windowRefaults = 0;
+    }
+
+    result.writebacks = memory.writebacks();
+    for (auto &proc : procs)
+    {
+        proc.stats.finalFrames = proc.resident;
+        result.processes.push_back(proc.stats);
+    }
+    return result;
+}
+
+void printMultiProcess(const std::vector<MultiProcessResult> &results, int frames, int window, size_t accessCount)
+{
+    size_t processCount = results.empty() ? 0 : results.front().processes.size();
+    std::cout << "\n=== Asignación de marcos entre procesos (" << processCount << " procesos, " << frames
+              << " marcos, ventana de " << window << " accesos) ===\n";
+    std::cout << std::left << std::setw(12) << "Asignación" << std::right << std::setw(10) << "Fallos"
+              << std::setw(16) << "Tasa de fallos" << std::setw(13) << "Escrituras" << std::setw(12) << "Thrashing"
+              << "\n";
+    for (const auto &result : results)
+    {
+        double rate = accessCount ? static_cast<double>(result.faults) / accessCount : 0.0;
+        std::cout << std::left << std::setw(12) << to_string(result.allocation) << std::right << std::setw(10)
+                  << result.faults << std::setw(16) << std::fixed << std::setprecision(4) << rate
+                  << std::defaultfloat << std::setw(13) << result.writebacks << std::setw(8)
+                  << result.thrashingWindows << "/" << result.windows << "\n";
+    }
+
+    for (const auto &result : results)
+    {
+        std::cout << "\n--- " << to_string(result.allocation) << " ---\n";
+        if (result.thrashingWindows > 0)
+            std::cout << "Thrashing detectado desde el acceso " << result.firstThrashing << "\n";
+        std::cout << std::setw(8) << "Proceso" << std::setw(10) << "Accesos" << std::setw(10) << "Fallos"
+                  << std::setw(16) << "Tasa de fallos" << std::setw(16) << "Marcos finales" << std::setw(14)
+                  << "Máx. marcos" << std::setw(12) << "Thrashing" << "\n";
+        for (const auto &proc : result.processes)
+        {
+            double rate = proc.accesses ? static_cast<double>(proc.faults) / proc.accesses : 0.0;
+            std::cout << std::setw(8) << proc.pid << std::setw(10) << proc.accesses << std::setw(10) << proc.faults
+                      << std::setw(16) << std::fixed << std::setprecision(4) << rate << std::defaultfloat
+                      << std::setw(16) << proc.finalFrames << std::setw(14) << proc.maxFrames << std::setw(8)
+                      << proc.thrashingWindows << "/" << result.windows << "\n";
+        }
+    }
+}
@@ -0,0 +1,103 @@
+#ifndef MULTI_PROCESS_HPP
+#define MULTI_PROCESS_HPP
+
+#include "AccessTrace.hpp"
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+// Ventana (en accesos) en que se mide la tasa de fallos de cada proceso
+const int DEFAULT_FAULT_RATE_WINDOW = 50;
+
+// Umbrales de la frecuencia de fallos (PFF): por encima el proceso recibe un marco más,
+// por debajo cede uno. Una tasa de refallos por encima del umbral superior es thrashing.
+const double PFF_UPPER_RATE = 0.25;
+const double PFF_LOWER_RATE = 0.05;
+
+// Traza de varios procesos: el acceso i es del proceso pids[i] a su página accesses.page(i)
+struct ProcessTrace
+{
+    AccessTrace accesses;
+    std::vector<int> pids;
+};
+
+// Parser incremental del formato "[1:2,1:6,2:1*,...]" (proceso:página). Un acceso sin
+// proceso ("5*") se asigna al proceso 0.
+class ProcessTokenizer
+{
+public:
+    void feed(const char *text, size_t length, ProcessTrace &out);
+    void finish(ProcessTrace &out);
+
+private:
+    void emit(ProcessTrace &out);
+
+    std::string token;
+};
+
+// Parsea una secuencia con procesos escrita en la entrada
+void parseProcessTrace(const std::string &input, ProcessTrace &trace);
+
+// Carga una secuencia con procesos desde un archivo de texto
+void loadProcessTrace(const std::string &path, ProcessTrace &trace);
+
+// Política de asignación de marcos entre procesos
+enum class FrameAllocation
+{
+    Global,     // Cualquier proceso puede reemplazar cualquier marco
+    LocalFixed, // Cada proceso tiene una cuota fija (reparto equitativo)
+    PFF         // Cuotas locales ajustadas por la frecuencia de fallos
+};
+
+std::string to_string(FrameAllocation allocation);
+
+// Resultado de un proceso
+struct ProcessStats
+{
+    int pid = 0;
+    size_t accesses = 0;
+    int64_t faults = 0;
+    int finalFrames = 0;      // Marcos que ocupa al terminar
+    int maxFrames = 0;        // Mayor cantidad de marcos que llegó a ocupar
+    int thrashingWindows = 0; // Ventanas en que su tasa de refallos superó PFF_UPPER_RATE
+};
+
+// Resultado de una política de asignación sobre toda la traza
+struct MultiProcessResult
+{
+    FrameAllocation allocation = FrameAllocation::Global;
+    int64_t faults = 0;
+    int64_t writebacks = 0;
+    int windows = 0;            // Ventanas completas evaluadas
+    int thrashingWindows = 0;   // Ventanas en que se detectó thrashing
+    size_t firstThrashing = 0;  // Acceso en que terminó la primera ventana con thrashing
+    std::vector<ProcessStats> processes;
+};
+
+/**
+ * @brief Simula varios procesos que comparten `frames` marcos con una política de asignación.
+ *
+ * Cada proceso tiene su propia tabla de páginas y su lista LRU. Con asignación global, un
+ * fallo reemplaza la página usada hace más tiempo de cualquier proceso; con asignación
+ * local, la del propio proceso si ya ocupa su cuota, o la de un proceso que excede la suya.
+ * Las cuotas locales empiezan repartidas por igual; con PFF, al final de cada ventana el
+ * proceso cuya tasa de fallos supera PFF_UPPER_RATE toma un marco libre y el que queda por
+ * debajo de PFF_LOWER_RATE cede uno.
+ *
+ * Se detecta thrashing por ventana con la tasa de refallos (fallos sobre páginas que ya
+ * estuvieron cargadas y fueron desalojadas, sin contar los fallos obligatorios del
+ * arranque): la ventana tiene thrashing si la tasa total supera PFF_UPPER_RATE, y cada
+ * proceso cuenta las ventanas en que la suya la supera.
+ *
+ * @param trace      Accesos etiquetados con su proceso.
+ * @param frames     Marcos de la memoria física compartida.
+ * @param allocation Política de asignación.
+ * @param window     Accesos por ventana de medición de la tasa de fallos.
+ */
+MultiProcessResult runMultiProcess(const ProcessTrace &trace, int frames, FrameAllocation allocation, int window);
+
+// Imprime la comparación de políticas y el detalle por proceso de cada una
+void printMultiProcess(const std::vector<MultiProcessResult> &results, int frames, int window, size_t accessCount);
+
+#endif // MULTI_PROCESS_HPP
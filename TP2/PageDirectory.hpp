@@ -0,0 +1,112 @@
+#ifndef PAGE_DIRECTORY_HPP
+#define PAGE_DIRECTORY_HPP
+
+#include "PageReplacement.hpp"
+#include "IndexList.hpp"
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+
+/**
+ * @brief Directorio de páginas residentes y fantasma sobre un arreglo fijo de nodos.
+ *
+ * Cada nodo guarda una página, el marco que ocupa (-1 si es un fantasma: solo queda su
+ * historia) y la lista a la que pertenece. Los nodos se enlazan con IndexLinks, así que
+ * mover una página entre listas es O(1) y no asigna memoria por acceso.
+ */
+struct PageDirectory
+{
+    std::vector<int> page;      // Página de cada nodo
+    std::vector<int> frame;     // Marco de cada nodo (-1 = fantasma)
+    std::vector<uint8_t> owner; // Lista a la que pertenece cada nodo
+    std::vector<int> freeNodes; // Nodos sin usar
+    IndexLinks links;
+    std::unordered_map<int, int> index; // Página → nodo
+
+    explicit PageDirectory(int capacity)
+        : page(capacity, -1), frame(capacity, -1), owner(capacity, 0), links(capacity)
+    {
+        for (int n = capacity - 1; n >= 0; --n)
+            freeNodes.push_back(n);
+        index.reserve(capacity);
+    }
+
+    int find(int p) const
+    {
+        auto it = index.find(p);
+        return (it == index.end()) ? -1 : it->second;
+    }
+
+    int acquire(int p)
+    {
+        int n = freeNodes.back();
+        freeNodes.pop_back();
+        page[n] = p;
+        frame[n] = -1;
+        index[p] = n;
+        return n;
+    }
+
+    void release(int n)
+    {
+        index.erase(page[n]);
+        page[n] = frame[n] = -1;
+        freeNodes.push_back(n);
+    }
+
+    // Bytes ocupados por los nodos, sus enlaces y el índice de páginas (estimado)
+    size_t metadataBytes() const
+    {
+        size_t nodes = page.size() * (2 * sizeof(int) + sizeof(uint8_t) + 2 * sizeof(int) + sizeof(int));
+        size_t hash = index.bucket_count() * sizeof(void *) +
+                      index.size() * (sizeof(std::pair<const int, int>) + sizeof(void *));
+        return nodes + hash;
+    }
+};
+
+/**
+ * @brief Marcos libres, entregados de menor a mayor índice.
+ */
+struct FreeFrames
+{
+    std::vector<int> frames;
+
+    explicit FreeFrames(const PageReplacementSimulator &sim)
+    {
+        for (int j = sim.frameCount - 1; j >= 0; --j)
+        {
+            if (sim.memory[j].pageNumber == -1)
+                frames.push_back(j);
+        }
+    }
+
+    bool empty() const { return frames.empty(); }
+
+    int take()
+    {
+        int j = frames.back();
+        frames.pop_back();
+        return j;
+    }
+
+    void give(int j) { frames.push_back(j); }
+};
+
+// Carga una página en un marco (R=1, M según el acceso, V=1). Si el marco todavía guarda
+// la página expulsada para liberarlo, se contabiliza su desalojo.
+inline void loadFrame(PageReplacementSimulator &sim, int j, int page, bool modified)
+{
+    recordEviction(sim, sim.memory[j]);
+    sim.memory[j].pageNumber = page;
+    sim.memory[j].bits = {true, modified, true};
+}
+
+// Marca un acierto sobre el marco de un nodo residente
+inline void touchFrame(PageReplacementSimulator &sim, int j, bool modified)
+{
+    sim.memory[j].bits.R = true;
+    if (modified)
+        sim.memory[j].bits.M = true;
+}
+
+#endif // PAGE_DIRECTORY_HPP
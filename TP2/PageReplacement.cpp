@@ -1,8 +1,8 @@
 #include "PageReplacement.hpp"
 #include <iostream>
-#include <sstream>
 #include <algorithm>
 #include <cctype>
+#include <unordered_set>
 
 // Convierte string a enum ReplacementAlgorithm
 ReplacementAlgorithm parseAlgorithm(const std::string &name)
@@ -24,51 +24,73 @@ ReplacementAlgorithm parseAlgorithm(const std::string &name)
         return ReplacementAlgorithm::LFU;
     if (lower == "mfu")
         return ReplacementAlgorithm::MFU;
+    if (lower == "aging")
+        return ReplacementAlgorithm::Aging;
+    if (lower == "arc")
+        return ReplacementAlgorithm::ARC;
+    if (lower == "2q")
+        return ReplacementAlgorithm::TwoQ;
+    if (lower == "lirs")
+        return ReplacementAlgorithm::LIRS;
+    if (lower == "clockpro")
+        return ReplacementAlgorithm::ClockPro;
+    if (lower == "wtinylfu" || lower == "w-tinylfu")
+        return ReplacementAlgorithm::WTinyLFU;
+    if (lower == "wsclock")
+        return ReplacementAlgorithm::WSClock;
+    if (lower == "dirtyclock")
+        return ReplacementAlgorithm::DirtyClock;
+    if (lower == "opt")
+        return ReplacementAlgorithm::OPT;
     if (lower == "all")
         return ReplacementAlgorithm::All;
+    if (lower == "mrc")
+        return ReplacementAlgorithm::MRC;
+    if (lower == "ws" || lower == "workingset")
+        return ReplacementAlgorithm::WorkingSet;
+    if (lower == "sweep")
+        return ReplacementAlgorithm::Sweep;
+    if (lower == "stream")
+        return ReplacementAlgorithm::Stream;
+    if (lower == "shards")
+        return ReplacementAlgorithm::Shards;
+    if (lower == "multi" || lower == "multiprocess")
+        return ReplacementAlgorithm::MultiProcess;
+    if (lower == "thp" || lower == "hugepages")
+        return ReplacementAlgorithm::HugePages;
+    if (lower == "prefetch")
+        return ReplacementAlgorithm::Prefetch;
+    if (lower == "tiers" || lower == "tiered")
+        return ReplacementAlgorithm::Tiered;
 
     std::cerr << "Error: algoritmo desconocido: " << name << std::endl;
     std::exit(EXIT_FAILURE);
 }
 
-// Parsea una cadena como "[2,6,1*,8,...]" en páginas y flags de modificación
-void parseAccessSequence(
-    const std::string &input,
-    std::vector<int> &pages,
-    std::vector<bool> &modifiedFlags)
+// Parsea una cadena como "[2,6,1*,8,...]" en accesos empaquetados (página + bit M)
+void parseAccessSequence(const std::string &input, AccessTrace &trace)
 {
-    std::string cleaned;
-    for (char c : input)
-    {
-        if (!std::isspace(c) && c != '[' && c != ']')
-        {
-            cleaned += c;
-        }
-    }
-
-    std::stringstream ss(cleaned);
-    std::string token;
+    AccessTokenizer tokenizer;
+    tokenizer.feed(input.data(), input.size(), trace);
+    tokenizer.finish(trace);
+}
 
-    while (std::getline(ss, token, ','))
+// Una página repetida se carga una sola vez: los algoritmos indexan cada página en un único
+// marco, y una copia sin indexar quedaría ocupando un marco que nunca se libera. Las páginas
+// que no caben en los marcos se ignoran.
+void loadInitialState(PageReplacementSimulator &sim, const AccessTrace &initial)
+{
+    std::unordered_set<int> loaded;
+    int j = 0;
+    for (size_t i = 0; i < initial.size() && j < sim.frameCount; ++i)
     {
-        bool modified = false;
-        if (!token.empty() && token.back() == '*')
-        {
-            modified = true;
-            token.pop_back();
-        }
-
-        try
-        {
-            int page = std::stoi(token);
-            pages.push_back(page);
-            modifiedFlags.push_back(modified);
-        }
-        catch (...)
-        {
-            std::cerr << "Error: entrada inválida en secuencia: " << token << std::endl;
-            std::exit(EXIT_FAILURE);
-        }
+        int page = initial.page(i);
+        if (!loaded.insert(page).second)
+            continue;
+        sim.memory[j].pageNumber = page;
+        sim.memory[j].bits = {true, false, true}; // R=1, M=0, V=1
+        sim.memory[j].frequency = sim.globalFrequencies[page] = 1;
+        j++;
     }
 }
 
@@ -94,3 +116,18 @@ void printMemory(const std::vector<PageFrame> &memory)
     }
     std::cout << std::endl;
 }
+
+// EAT = acceso a memoria + (fallos · lectura + escrituras · escritura) / accesos
+double effectiveAccessTime(const PageReplacementSimulator &sim, size_t accessCount)
+{
+    if (accessCount == 0)
+        return 0.0;
+    double stalls = sim.pageFaults * sim.readFaultLatency + sim.writebacks * sim.writebackLatency;
+    return MEMORY_ACCESS_US + stalls / accessCount;
+}
+
+// Cada fallo lee una página y cada escritura de una página sucia escribe otra
+long long ioVolumeBytes(const PageReplacementSimulator &sim)
+{
+    return (sim.pageFaults + sim.writebacks) * PAGE_SIZE_BYTES;
+}
@@ -1,6 +1,7 @@
 #ifndef PAGE_REPLACEMENT_HPP
 #define PAGE_REPLACEMENT_HPP
 
+#include "AccessTrace.hpp"
 #include <vector>
 #include <string>
 #include <unordered_map>
@@ -8,6 +9,24 @@
 // Número de marcos por defecto
 const int DEFAULT_FRAME_COUNT = 4;
 
+// Accesos entre dos tics del temporizador simulado (reinicio del bit R en NRU, Aging)
+const int DEFAULT_TIMER_INTERVAL = 5;
+
+// Ancho en bits del contador de envejecimiento (8, 16 o 32)
+const int DEFAULT_AGING_BITS = 8;
+
+// Ventana τ del conjunto de trabajo, en accesos (tiempo virtual) para WSClock y el modo WS
+const int DEFAULT_WORKING_SET_WINDOW = 4;
+
+// Modelo de costo (microsegundos): acceso a memoria, lectura de una página por fallo y
+// escritura a disco de una página modificada al desalojarla
+const double MEMORY_ACCESS_US = 0.1;
+const double DEFAULT_READ_FAULT_US = 8000.0;
+const double DEFAULT_WRITEBACK_US = 12000.0;
+
+// Tamaño de página para el volumen de E/S
+const int PAGE_SIZE_BYTES = 4096;
+
 // Bits de control
 struct PageBits
 {
@@ -19,10 +38,10 @@ struct PageBits
 // Representación de una página en memoria
 struct PageFrame
 {
-    int pageNumber = -1; // Número de página
-    PageBits bits;       // Bits R, M, V
-    int timestamp = 0;   // Para LRU
-    int frequency = 0;   // Para LFU/MFU
+    int pageNumber = -1;   // Número de página
+    PageBits bits;         // Bits R, M, V
+    int64_t timestamp = 0; // Para LRU (en WSClock: tiempo virtual del último uso)
+    int frequency = 0;     // Para LFU/MFU
 };
 
 // Enum con los algoritmos disponibles
@@ -35,7 +54,25 @@ enum class ReplacementAlgorithm
     Clock,
     LFU,
     MFU,
-    All
+    Aging,
+    ARC,
+    TwoQ,
+    LIRS,
+    ClockPro,
+    WTinyLFU,
+    WSClock,
+    DirtyClock,
+    OPT, // Óptimo de Belady (referencia)
+    All,
+    MRC,        // Curva de fallos LRU para todas las cantidades de marcos
+    WorkingSet, // Tamaño del conjunto de trabajo en el tiempo para una ventana τ
+    Sweep,      // Matriz de fallos para un rango de marcos y una lista de algoritmos
+    Stream,     // Varios algoritmos a la vez sobre una traza leída por bloques
+    Shards,     // Tasas de fallos estimadas sobre una muestra de páginas
+    MultiProcess, // Varios procesos compartiendo marcos con asignación global o local
+    HugePages,    // Páginas base y grandes con políticas de promoción y degradación
+    Prefetch,     // Algoritmos con y sin precarga de las páginas predichas
+    Tiered        // Niveles de memoria: DRAM, swap comprimido y disco
 };
 
 // Estructura principal para el simulador
@@ -45,22 +82,60 @@ struct PageReplacementSimulator
     ReplacementAlgorithm algorithm;
     std::vector<PageFrame> memory;
     int clockHand = 0; // Para Clock
-    int pageFaults = 0;
-    int globalTime = 0;
+    // Contadores y tiempo de 64 bits: una traza en streaming puede superar los 2^31 accesos
+    int64_t pageFaults = 0;
+    int64_t globalTime = 0;
+    int timerInterval = DEFAULT_TIMER_INTERVAL;        // Accesos por tic del temporizador (0 = sin tics)
+    int agingBits = DEFAULT_AGING_BITS;                // Ancho del contador de Aging
+    int workingSetWindow = DEFAULT_WORKING_SET_WINDOW; // Ventana τ de WSClock
+    size_t metadataBytes = 0;                          // Metadatos de reemplazo por algoritmo (bytes)
+    int64_t cleanEvictions = 0;                        // Desalojos de páginas con M=0
+    int64_t dirtyEvictions = 0;                        // Desalojos de páginas con M=1
+    int64_t writebacks = 0;                            // Páginas escritas a disco
+    double readFaultLatency = DEFAULT_READ_FAULT_US;   // Costo de leer una página (µs)
+    double writebackLatency = DEFAULT_WRITEBACK_US;    // Costo de escribir una página sucia (µs)
     std::unordered_map<int, int> globalFrequencies;
+    size_t accessCount = 0;                            // Accesos simulados (al continuar desde un checkpoint, fase del temporizador)
+    std::vector<int> policyState;                      // Estado del algoritmo fuera de los marcos (cola de FIFO, contadores de Aging)
+    std::vector<PackedAccess> *evictionLog = nullptr;  // Si no es nulo, recibe cada página desalojada (con su bit M)
 
     PageReplacementSimulator(int count, ReplacementAlgorithm algo)
         : frameCount(count), algorithm(algo), memory(count) {}
 };
 
+// Contabiliza el desalojo de la página que ocupa `frame` (si hay una), antes de reemplazarla.
+// Una página modificada debe escribirse a disco antes de liberar el marco.
+inline void recordEviction(PageReplacementSimulator &sim, const PageFrame &frame)
+{
+    if (frame.pageNumber == -1)
+        return;
+    if (sim.evictionLog)
+        sim.evictionLog->push_back(packAccess(frame.pageNumber, frame.bits.M));
+    if (frame.bits.M)
+    {
+        sim.dirtyEvictions++;
+        sim.writebacks++;
+    }
+    else
+    {
+        sim.cleanEvictions++;
+    }
+}
+
+// Tiempo efectivo de acceso (µs): acceso a memoria más el costo promedio de fallos y escrituras
+double effectiveAccessTime(const PageReplacementSimulator &sim, size_t accessCount);
+
+// Bytes transferidos con el disco: páginas leídas por fallos y páginas escritas
+long long ioVolumeBytes(const PageReplacementSimulator &sim);
+
 // Función para convertir string a ReplacementAlgorithm
 ReplacementAlgorithm parseAlgorithm(const std::string &name);
 
-// Función para parsear la secuencia de accesos (e.g. [1*,2,3])
-void parseAccessSequence(
-    const std::string &input,
-    std::vector<int> &pages,
-    std::vector<bool> &modifiedFlags);
+// Función para parsear la secuencia de accesos (e.g. [1*,2,3]) en una traza empaquetada
+void parseAccessSequence(const std::string &input, AccessTrace &trace);
+
+// Carga las primeras páginas distintas de `initial` en los marcos (R=1, M=0, V=1, frecuencia 1)
+void loadInitialState(PageReplacementSimulator &sim, const AccessTrace &initial);
 
 // Función para imprimir el estado actual de la memoria
 void printMemory(const std::vector<PageFrame> &memory);
@@ -77,7 +152,25 @@ inline std::string to_string(ReplacementAlgorithm algo) {
         case ReplacementAlgorithm::Clock: return "Clock";
         case ReplacementAlgorithm::LFU: return "LFU";
         case ReplacementAlgorithm::MFU: return "MFU";
+        case ReplacementAlgorithm::Aging: return "Aging";
+        case ReplacementAlgorithm::ARC: return "ARC";
+        case ReplacementAlgorithm::TwoQ: return "2Q";
+        case ReplacementAlgorithm::LIRS: return "LIRS";
+        case ReplacementAlgorithm::ClockPro: return "ClockPro";
+        case ReplacementAlgorithm::WTinyLFU: return "W-TinyLFU";
+        case ReplacementAlgorithm::WSClock: return "WSClock";
+        case ReplacementAlgorithm::DirtyClock: return "DirtyClock";
+        case ReplacementAlgorithm::OPT: return "OPT";
         case ReplacementAlgorithm::All: return "All";
+        case ReplacementAlgorithm::MRC: return "MRC";
+        case ReplacementAlgorithm::WorkingSet: return "WS";
+        case ReplacementAlgorithm::Sweep: return "Sweep";
+        case ReplacementAlgorithm::Stream: return "Stream";
+        case ReplacementAlgorithm::Shards: return "SHARDS";
+        case ReplacementAlgorithm::MultiProcess: return "Multi";
+        case ReplacementAlgorithm::HugePages: return "THP";
+        case ReplacementAlgorithm::Prefetch: return "Prefetch";
+        case ReplacementAlgorithm::Tiered: return "Tiers";
         default: return "Desconocido";
     }
 }
@@ -0,0 +1,101 @@
+#ifndef POLICY_DRIVER_HPP
+#define POLICY_DRIVER_HPP
+
+#include "PageReplacement.hpp"
+#include "PageDirectory.hpp"
+#include "AccessTrace.hpp"
+#include <cstdlib>
+#include <iostream>
+#include <unordered_map>
+
+// Ganchos por defecto (vacíos) de una política de reemplazo; cada política define solo los que usa
+struct ReplacementPolicy
+{
+    void onAccess(size_t) {}    // Antes de buscar la página del acceso i (tiempo virtual)
+    void afterAccess(size_t) {} // Después del acceso i, acierto o fallo (tics del temporizador)
+    void finish() {}            // Al terminar la traza (volcar estado a los marcos)
+};
+
+/**
+ * @brief Bucle común de los algoritmos que guardan sus páginas en sim.memory con un índice
+ *        página → marco.
+ *
+ * Resuelve lo que todos repetían: buscar la página, contar el fallo, tomar el primer marco
+ * libre (los marcos nunca se liberan, así que solo avanza) o pedir una víctima, contabilizar
+ * su desalojo y cargar la página (R=1, M según el acceso, V=1). La política decide el resto
+ * con estos métodos, que se inlinean en el bucle porque el tipo se conoce al compilar:
+ *  - `onHit(j, modified)`: la página del marco j se volvió a usar.
+ *  - `pickVictim()`: marco a desalojar con la memoria llena (y lo quita de sus estructuras).
+ *  - `onInsert(j)`: se cargó una página en el marco j.
+ *  - Los ganchos de ReplacementPolicy, si los redefine.
+ *
+ * @param sim      Simulador con los marcos (y el estado inicial ya cargado).
+ * @param accesses Cursor sobre los accesos empaquetados.
+ * @param policy   Política de reemplazo.
+ */
+template <typename Policy>
+void runPolicyLoop(PageReplacementSimulator &sim, AccessCursor &accesses, Policy &policy)
+{
+    std::unordered_map<int, int> pageFrame; // Página → índice del marco que la contiene
+    pageFrame.reserve(sim.frameCount);
+    for (int j = 0; j < sim.frameCount; ++j)
+    {
+        // Cada página ocupa un solo marco (loadInitialState no repite páginas): una copia sin
+        // indexar quedaría en la política pero no en el índice, y desalojarla borraría la otra
+        if (sim.memory[j].pageNumber != -1 && !pageFrame.emplace(sim.memory[j].pageNumber, j).second)
+        {
+            std::cerr << "Error: la página " << sim.memory[j].pageNumber << " ocupa más de un marco.\n";
+            std::exit(EXIT_FAILURE);
+        }
+    }
+
+    int nextFree = 0; // Los marcos nunca se liberan: el primer marco libre solo avanza
+
+    PackedAccess access;
+    for (size_t i = 0; accesses.next(access); ++i)
+    {
+        int page = accessPage(access);
+        bool modified = accessModified(access);
+        policy.onAccess(i);
+
+        auto it = pageFrame.find(page);
+        if (it != pageFrame.end())
+        {
+            policy.onHit(it->second, modified);
+        }
+        else
+        {
+            // Fallo de página
+            sim.pageFaults++;
+
+            while (nextFree < sim.frameCount && sim.memory[nextFree].pageNumber != -1)
+                nextFree++;
+
+            int target = nextFree;
+            if (target == sim.frameCount)
+            {
+                target = policy.pickVictim();
+                pageFrame.erase(sim.memory[target].pageNumber);
+            }
+
+            loadFrame(sim, target, page, modified);
+            pageFrame[page] = target;
+            policy.onInsert(target);
+        }
+
+        policy.afterAccess(i);
+    }
+
+    policy.finish();
+}
+
+// Construye la política sobre el simulador y recorre la traza; con el tipo fijo es un puntero
+// a función, así que el despacho por algoritmo es una tabla de estas instancias
+template <typename Policy>
+void runPolicy(PageReplacementSimulator &sim, AccessCursor &accesses)
+{
+    Policy policy(sim);
+    runPolicyLoop(sim, accesses, policy);
+}
+
+#endif // POLICY_DRIVER_HPP
@@ -0,0 +1,267 @@
+#include "Prefetch.hpp"
+#include "Algorithms.hpp"
+#include "WorkStealingPool.hpp"
+#include <algorithm>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+
+// Agrega una candidata si entra en el rango de páginas de la traza (-1 marca un marco vacío)
+static void addCandidate(long long page, std::vector<int> &candidates)
+{
+    if (page >= MIN_TRACE_PAGE && page <= MAX_TRACE_PAGE && page != -1)
+        candidates.push_back(static_cast<int>(page));
+}
+
+void SequentialPredictor::predict(int page, int degree, std::vector<int> &candidates)
+{
+    for (int k = 1; k <= degree; ++k)
+        addCandidate(static_cast<long long>(page) + k, candidates);
+}
+
+void StridePredictor::observe(int page)
+{
+    if (started)
+    {
+        int stride = page - lastPage;
+        confirmed = stride != 0 && stride == lastStride;
+        lastStride = stride;
+    }
+    started = true;
+    lastPage = page;
+}
+
+void StridePredictor::predict(int page, int degree, std::vector<int> &candidates)
+{
+    if (!confirmed)
+        return;
+    for (int k = 1; k <= degree; ++k)
+        addCandidate(static_cast<long long>(page) + static_cast<long long>(k) * lastStride, candidates);
+}
+
+void MarkovPredictor::observe(int page)
+{
+    if (started && page != lastPage)
+    {
+        auto &list = successors[lastPage];
+        auto it = std::find_if(list.begin(), list.end(), [&](const Successor &s) { return s.page == page; });
+        if (it != list.end())
+            it->count++;
+        else if (list.size() < static_cast<size_t>(MARKOV_SUCCESSORS))
+            list.push_back({page, 1});
+        else
+            *std::min_element(list.begin(), list.end(),
+                              [](const Successor &a, const Successor &b) { return a.count < b.count; }) = {page, 1};
+    }
+    started = true;
+    lastPage = page;
+}
+
+void MarkovPredictor::predict(int page, int degree, std::vector<int> &candidates)
+{
+    auto it = successors.find(page);
+    if (it == successors.end())
+        return;
+    std::vector<Successor> ranked = it->second;
+    std::stable_sort(ranked.begin(), ranked.end(),
+                     [](const Successor &a, const Successor &b) { return a.count > b.count; });
+    for (size_t k = 0; k < ranked.size() && k < static_cast<size_t>(degree); ++k)
+        candidates.push_back(ranked[k].page);
+}
+
+std::string to_string(PrefetchKind kind)
+{
+    switch (kind)
+    {
+        case PrefetchKind::Sequential: return "Secuencial";
+        case PrefetchKind::Stride: return "Stride";
+        case PrefetchKind::Markov: return "Markov";
+    }
+    return "Desconocido";
+}
+
+std::unique_ptr<PrefetchPredictor> makePrefetchPredictor(PrefetchKind kind)
+{
+    switch (kind)
+    {
+        case PrefetchKind::Sequential: return std::make_unique<SequentialPredictor>();
+        case PrefetchKind::Stride: return std::make_unique<StridePredictor>();
+        case PrefetchKind::Markov: return std::make_unique<MarkovPredictor>();
+    }
+    return nullptr;
+}
+
+PrefetchStage::PrefetchStage(const AccessTrace &trace, PageReplacementSimulator &sim, std::vector<PackedAccess> &log,
+                             PrefetchPredictor &predictor, int degree)
+    : pos(trace.begin()), last(trace.end()), sim(sim), log(log), predictor(predictor), degree(degree)
+{
+    for (const auto &frame : sim.memory)
+    {
+        if (frame.pageNumber != -1)
+            resident.insert(frame.pageNumber); // Estado inicial
+    }
+}
+
+bool PrefetchStage::nextChunk(const PackedAccess *&begin, const PackedAccess *&end)
+{
+    if (delivered)
+        settle();
+
+    if (!queue.empty())
+    {
+        current = packAccess(queue.back(), false);
+        queue.pop_back();
+        currentPrefetch = true;
+    }
+    else
+    {
+        if (pos == last)
+            return false;
+        current = *pos++;
+        currentPrefetch = false;
+        predictor.observe(accessPage(current));
+    }
+
+    faultsBefore = sim.pageFaults;
+    delivered = true;
+    begin = &current;
+    end = &current + 1;
+    return true;
+}
+
+// Contabiliza el acceso entregado: el algoritmo ya lo procesó, así que su contador de
+// fallos dice si la página estaba en memoria
+void PrefetchStage::settle()
+{
+    delivered = false;
+    bool faulted = sim.pageFaults > faultsBefore;
+    int page = accessPage(current);
+    for (PackedAccess evicted : log)
+        resident.erase(accessPage(evicted));
+    log.clear();
+    if (faulted)
+        resident.insert(page);
+
+    if (currentPrefetch)
+    {
+        if (faulted)
+        {
+            result.issued++;
+            unused.insert(page);
+        }
+        return;
+    }
+
+    if (faulted)
+    {
+        // Una página precargada que vuelve a fallar se desalojó sin usarse
+        result.demandFaults++;
+        unused.erase(page);
+        trigger(page);
+    }
+    else if (unused.erase(page))
+    {
+        result.useful++;
+        trigger(page);
+    }
+}
+
+// Pide candidatas al predictor y encola las que no están en memoria ni repetidas
+void PrefetchStage::trigger(int page)
+{
+    if (pos == last)
+        return;
+
+    candidates.clear();
+    predictor.predict(page, degree, candidates);
+
+    skip.assign(candidates.size(), 0);
+    for (size_t k = 0; k < candidates.size(); ++k)
+    {
+        skip[k] = candidates[k] == page || resident.count(candidates[k]) ||
+                  std::find(candidates.begin(), candidates.begin() + k, candidates[k]) != candidates.begin() + k;
+    }
+
+    for (size_t k = candidates.size(); k-- > 0;)
+    {
+        if (!skip[k])
+            queue.push_back(candidates[k]);
+    }
+}
+
+PrefetchResult runPrefetch(const AccessTrace &trace, const AccessTrace &initial, int frames,
+                           const std::vector<ReplacementAlgorithm> &algorithms, int degree,
+                           const PageReplacementSimulator &settings, unsigned threads)
+{
+    PrefetchResult result;
+    result.frames = frames;
+    result.degree = degree;
+    result.algorithms = algorithms;
+    result.baseline.assign(algorithms.size(), 0);
+    result.stats.assign(std::size(PREFETCH_KINDS), std::vector<PrefetchStats>(algorithms.size()));
+
+    auto configure = [&](PageReplacementSimulator &sim) {
+        sim.timerInterval = settings.timerInterval;
+        sim.agingBits = settings.agingBits;
+        sim.workingSetWindow = settings.workingSetWindow;
+        loadInitialState(sim, initial);
+    };
+
+    // Una tarea por algoritmo sin prefetch y una por cada par (predictor, algoritmo)
+    std::vector<std::function<void()>> tasks;
+    for (size_t a = 0; a < algorithms.size(); ++a)
+    {
+        tasks.push_back([&, a]() {
+            PageReplacementSimulator sim(frames, algorithms[a]);
+            configure(sim);
+            runAlgorithm(sim, trace);
+            result.baseline[a] = sim.pageFaults;
+        });
+
+        for (size_t p = 0; p < std::size(PREFETCH_KINDS); ++p)
+        {
+            tasks.push_back([&, a, p]() {
+                PageReplacementSimulator sim(frames, algorithms[a]);
+                configure(sim);
+                auto predictor = makePrefetchPredictor(PREFETCH_KINDS[p]);
+                std::vector<PackedAccess> log;
+                sim.evictionLog = &log;
+                PrefetchStage stage(trace, sim, log, *predictor, degree);
+                AccessCursor accesses(stage);
+                runAlgorithm(sim, accesses);
+                result.stats[p][a] = stage.stats();
+            });
+        }
+    }
+
+    WorkStealingPool pool(threads);
+    pool.run(std::move(tasks));
+    return result;
+}
+
+void printPrefetch(const PrefetchResult &result, size_t accessCount)
+{
+    std::cout << "\n=== Prefetch (" << result.frames << " marcos, hasta " << result.degree
+              << " páginas por disparo, " << accessCount << " accesos) ===\n";
+    for (size_t p = 0; p < result.stats.size(); ++p)
+    {
+        std::cout << "\n--- " << to_string(PREFETCH_KINDS[p]) << " ---\n";
+        std::cout << std::left << std::setw(14) << "Algoritmo" << std::right << std::setw(14) << "Sin prefetch"
+                  << std::setw(14) << "Con prefetch" << std::setw(12) << "Reducción" << std::setw(12) << "Precargas"
+                  << std::setw(10) << "Útiles" << std::setw(16) << "Desperdiciadas" << std::setw(12) << "Precisión"
+                  << "\n";
+        for (size_t a = 0; a < result.algorithms.size(); ++a)
+        {
+            const PrefetchStats &row = result.stats[p][a];
+            int64_t baseline = result.baseline[a];
+            double reduction = baseline ? 100.0 * (baseline - row.demandFaults) / baseline : 0.0;
+            double accuracy = row.issued ? static_cast<double>(row.useful) / row.issued : 0.0;
+            std::cout << std::left << std::setw(14) << to_string(result.algorithms[a]) << std::right << std::setw(14)
+                      << baseline << std::setw(14) << row.demandFaults << std::setw(11) << std::fixed
+                      << std::setprecision(1) << reduction << "%" << std::setw(12) << row.issued << std::setw(10)
+                      << row.useful << std::setw(16) << row.issued - row.useful << std::setw(12)
+                      << std::setprecision(4) << accuracy << std::defaultfloat << "\n";
+        }
+    }
+}
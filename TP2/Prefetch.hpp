@@ -0,0 +1,168 @@
+#ifndef PREFETCH_HPP
+#define PREFETCH_HPP
+
+#include "PageReplacement.hpp"
+#include "AccessTrace.hpp"
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// Páginas que se predicen como máximo en cada disparo del prefetch (grado)
+const int DEFAULT_PREFETCH_DEGREE = 4;
+
+// Sucesores que recuerda el predictor de Markov por página
+const int MARKOV_SUCCESSORS = 4;
+
+/**
+ * @brief Predictor de las próximas páginas de la traza.
+ *
+ * Ve cada acceso de demanda (`observe`) y, cuando se dispara el prefetch (un fallo de
+ * demanda o el primer uso de una página precargada), propone hasta `degree` páginas.
+ */
+class PrefetchPredictor
+{
+public:
+    virtual ~PrefetchPredictor() = default;
+
+    virtual void observe(int page) = 0;
+    virtual void predict(int page, int degree, std::vector<int> &candidates) = 0;
+};
+
+// Lectura anticipada secuencial (readahead): las páginas siguientes a la que disparó
+class SequentialPredictor : public PrefetchPredictor
+{
+public:
+    void observe(int) override {}
+    void predict(int page, int degree, std::vector<int> &candidates) override;
+};
+
+// Detección de paso: si los dos últimos saltos entre accesos son iguales, sigue ese paso
+class StridePredictor : public PrefetchPredictor
+{
+public:
+    void observe(int page) override;
+    void predict(int page, int degree, std::vector<int> &candidates) override;
+
+private:
+    bool started = false;
+    int lastPage = 0;
+    int lastStride = 0;
+    bool confirmed = false; // ¿El último salto repitió el anterior?
+};
+
+// Markov de primer orden: las páginas que más veces siguieron a la que disparó
+class MarkovPredictor : public PrefetchPredictor
+{
+public:
+    void observe(int page) override;
+    void predict(int page, int degree, std::vector<int> &candidates) override;
+
+private:
+    struct Successor
+    {
+        int page = 0;
+        int count = 0;
+    };
+
+    bool started = false;
+    int lastPage = 0;
+    std::unordered_map<int, std::vector<Successor>> successors;
+};
+
+enum class PrefetchKind
+{
+    Sequential,
+    Stride,
+    Markov
+};
+
+const PrefetchKind PREFETCH_KINDS[] = {PrefetchKind::Sequential, PrefetchKind::Stride, PrefetchKind::Markov};
+
+std::string to_string(PrefetchKind kind);
+
+std::unique_ptr<PrefetchPredictor> makePrefetchPredictor(PrefetchKind kind);
+
+// Resultado de un algoritmo con un predictor
+struct PrefetchStats
+{
+    int64_t demandFaults = 0; // Fallos de los accesos de la traza
+    int64_t issued = 0;       // Páginas precargadas (no estaban en memoria)
+    int64_t useful = 0;       // Precargadas que se usaron antes de desalojarse
+};
+
+struct PrefetchResult
+{
+    int frames = 0;
+    int degree = 0;
+    std::vector<ReplacementAlgorithm> algorithms;
+    std::vector<int64_t> baseline;                 // Fallos sin prefetch, por algoritmo
+    std::vector<std::vector<PrefetchStats>> stats; // [predictor][algoritmo], en orden de PREFETCH_KINDS
+};
+
+/**
+ * @brief Etapa de prefetch entre la traza y un algoritmo de reemplazo.
+ *
+ * Entrega al algoritmo un acceso por bloque para ver, antes de cada uno, si el anterior
+ * falló (el contador de fallos del simulador). Tras un fallo de demanda, o al usar por
+ * primera vez una página precargada, le pide candidatas al predictor y descarta las que ya
+ * están en memoria; las demás se entregan como accesos de lectura antes del próximo acceso
+ * de la traza, así que el algoritmo las carga en sus propias estructuras como cualquier
+ * página. Sus fallos se cuentan como precargas y no como fallos de demanda.
+ *
+ * Las páginas en memoria las lleva la propia etapa, como los niveles de Tiers: entra la
+ * página de cada acceso que falló y sale cada página del registro de desalojos del
+ * simulador (`log`), así que no lee los marcos durante la simulación.
+ */
+class PrefetchStage : public ChunkSource
+{
+public:
+    PrefetchStage(const AccessTrace &trace, PageReplacementSimulator &sim, std::vector<PackedAccess> &log,
+                  PrefetchPredictor &predictor, int degree);
+
+    bool nextChunk(const PackedAccess *&begin, const PackedAccess *&end) override;
+
+    const PrefetchStats &stats() const { return result; }
+
+private:
+    void settle();
+    void trigger(int page);
+
+    const PackedAccess *pos;
+    const PackedAccess *last;
+    PageReplacementSimulator &sim;
+    std::vector<PackedAccess> &log;   // Registro de desalojos del simulador
+    PrefetchPredictor &predictor;
+    int degree;
+    PackedAccess current = 0;         // Acceso entregado en el último bloque
+    bool currentPrefetch = false;     // ¿Era una precarga?
+    bool delivered = false;           // ¿Hay un acceso entregado sin contabilizar?
+    int64_t faultsBefore = 0;         // Fallos del simulador antes de entregarlo
+    std::vector<int> queue;           // Precargas por entregar (en orden inverso)
+    std::vector<int> candidates;
+    std::vector<char> skip;           // Candidatas descartadas del último disparo
+    std::unordered_set<int> resident; // Páginas en memoria
+    std::unordered_set<int> unused;   // Páginas precargadas todavía no usadas
+    PrefetchStats result;
+};
+
+/**
+ * @brief Compara cada algoritmo sin prefetch y con cada predictor, en paralelo.
+ *
+ * @param trace      Secuencia de accesos compartida (solo lectura).
+ * @param initial    Páginas cargadas al inicio (vacía = memoria vacía).
+ * @param frames     Cantidad de marcos.
+ * @param algorithms Algoritmos de reemplazo (sin OPT, que necesita conocer el futuro).
+ * @param degree     Páginas por disparo del prefetch.
+ * @param settings   Simulador del que se copian los parámetros de configuración.
+ * @param threads    Hilos a usar (0 = uno por núcleo).
+ */
+PrefetchResult runPrefetch(const AccessTrace &trace, const AccessTrace &initial, int frames,
+                           const std::vector<ReplacementAlgorithm> &algorithms, int degree,
+                           const PageReplacementSimulator &settings, unsigned threads = 0);
+
+// Imprime una tabla por predictor: fallos sin y con prefetch, reducción y precargas útiles
+void printPrefetch(const PrefetchResult &result, size_t accessCount);
+
+#endif // PREFETCH_HPP
@@ -0,0 +1,665 @@
+#include "Algorithms.hpp"
+#include "PageDirectory.hpp"
+#include <algorithm>
+#include <cstdint>
+
+/**
+ * @brief Simula ARC (Adaptive Replacement Cache, Megiddo y Modha).
+ *
+ * Mantiene dos listas residentes, T1 (páginas vistas una vez recientemente) y T2 (vistas
+ * al menos dos veces), y dos listas fantasma B1 y B2 con la historia de lo expulsado de
+ * cada una. Un acierto en B1 indica que T1 debió ser más grande y aumenta el objetivo p;
+ * un acierto en B2 lo reduce. Un recorrido secuencial solo pasa por T1, de modo que no
+ * expulsa el conjunto de trabajo frecuente de T2. Todas las operaciones son O(1).
+ *
+ * @param sim      Referencia al simulador con marcos, contador de fallos, etc.
+ * @param accesses Cursor sobre los accesos empaquetados (página y bit M por palabra).
+ */
+void runARC(PageReplacementSimulator &sim, AccessCursor &accesses)
+{
+    enum : uint8_t { T1, T2, B1, B2 };
+
+    const int c = sim.frameCount;
+    PageDirectory dir(2 * c + 1);
+    IndexList lists[4] = {IndexList(dir.links), IndexList(dir.links), IndexList(dir.links), IndexList(dir.links)};
+    FreeFrames freeFrames(sim);
+    int p = 0; // Tamaño objetivo de T1
+
+    auto moveTo = [&](int n, uint8_t target) {
+        lists[dir.owner[n]].remove(n);
+        dir.owner[n] = target;
+        lists[target].pushBack(n);
+    };
+
+    // Expulsa el LRU de T1 o de T2 hacia su lista fantasma y libera su marco
+    auto replace = [&](bool inB2) {
+        int t1 = lists[T1].size;
+        uint8_t from = (t1 >= 1 && ((inB2 && t1 == p) || t1 > p)) ? T1 : T2;
+        if (lists[from].empty())
+            from = (from == T1) ? T2 : T1;
+        int victim = lists[from].head;
+        freeFrames.give(dir.frame[victim]);
+        dir.frame[victim] = -1;
+        moveTo(victim, from == T1 ? B1 : B2);
+    };
+
+    auto dropLRU = [&](uint8_t from) {
+        int n = lists[from].popFront();
+        dir.release(n);
+    };
+
+    // Estado inicial: las páginas ya cargadas entran a T1 en orden de marco
+    for (int j = 0; j < c; ++j)
+    {
+        int page = sim.memory[j].pageNumber;
+        if (page != -1 && dir.find(page) == -1)
+        {
+            int n = dir.acquire(page);
+            dir.frame[n] = j;
+            dir.owner[n] = T1;
+            lists[T1].pushBack(n);
+        }
+    }
+
+    PackedAccess access;
+    for (size_t i = 0; accesses.next(access); ++i)
+    {
+        int page = accessPage(access);
+        bool modified = accessModified(access);
+        int n = dir.find(page);
+
+        // Caso I: acierto en T1 o T2 → pasa al MRU de T2
+        if (n != -1 && dir.frame[n] != -1)
+        {
+            touchFrame(sim, dir.frame[n], modified);
+            moveTo(n, T2);
+            continue;
+        }
+
+        sim.pageFaults++;
+
+        if (n != -1)
+        {
+            // Casos II y III: la página está en la historia → adaptar p y cargarla en T2
+            bool inB2 = dir.owner[n] == B2;
+            int b1 = lists[B1].size, b2 = lists[B2].size;
+            if (inB2)
+                p = std::max(0, p - std::max(b1 / b2, 1));
+            else
+                p = std::min(c, p + std::max(b2 / b1, 1));
+
+            if (freeFrames.empty())
+                replace(inB2);
+            dir.frame[n] = freeFrames.take();
+            moveTo(n, T2);
+            loadFrame(sim, dir.frame[n], page, modified);
+            continue;
+        }
+
+        // Caso IV: página nueva
+        int l1 = lists[T1].size + lists[B1].size;
+        int total = l1 + lists[T2].size + lists[B2].size;
+        if (l1 == c)
+        {
+            if (lists[T1].size < c)
+            {
+                dropLRU(B1);
+                if (freeFrames.empty())
+                    replace(false);
+            }
+            else
+            {
+                // T1 ocupa toda la memoria: su LRU se descarta sin dejar historia
+                int victim = lists[T1].head;
+                freeFrames.give(dir.frame[victim]);
+                dropLRU(T1);
+            }
+        }
+        else if (total >= c)
+        {
+            if (total >= 2 * c)
+                dropLRU(B2);
+            if (freeFrames.empty())
+                replace(false);
+        }
+
+        n = dir.acquire(page);
+        dir.frame[n] = freeFrames.take();
+        dir.owner[n] = T1;
+        lists[T1].pushBack(n);
+        loadFrame(sim, dir.frame[n], page, modified);
+    }
+
+    sim.metadataBytes = dir.metadataBytes();
+}
+
+/**
+ * @brief Simula 2Q (Johnson y Shasha, versión completa).
+ *
+ * Las páginas nuevas entran a A1in, una cola FIFO residente de tamaño Kin (25% de los
+ * marcos). Al salir de A1in su historia pasa a A1out, una cola fantasma de Kout entradas
+ * (50% de los marcos). Solo una página pedida de nuevo mientras está en A1out se considera
+ * caliente y entra a Am, una lista LRU residente. Así, un recorrido secuencial circula por
+ * A1in sin desplazar a Am. Todas las operaciones son O(1).
+ *
+ * @param sim      Referencia al simulador con marcos, contador de fallos, etc.
+ * @param accesses Cursor sobre los accesos empaquetados (página y bit M por palabra).
+ */
+void runTwoQ(PageReplacementSimulator &sim, AccessCursor &accesses)
+{
+    enum : uint8_t { A1in, A1out, Am };
+
+    const int c = sim.frameCount;
+    const int kin = std::max(1, c / 4);
+    const int kout = std::max(1, c / 2);
+    PageDirectory dir(c + kout + 1);
+    IndexList lists[3] = {IndexList(dir.links), IndexList(dir.links), IndexList(dir.links)};
+    FreeFrames freeFrames(sim);
+
+    // Libera un marco: expulsa de A1in si excede Kin (dejando historia) o el LRU de Am
+    auto reclaim = [&]() {
+        if (!freeFrames.empty())
+            return;
+        if (lists[A1in].size > kin || lists[Am].empty())
+        {
+            int victim = lists[A1in].popFront();
+            freeFrames.give(dir.frame[victim]);
+            dir.frame[victim] = -1;
+            if (lists[A1out].size >= kout)
+                dir.release(lists[A1out].popFront());
+            dir.owner[victim] = A1out;
+            lists[A1out].pushBack(victim);
+        }
+        else
+        {
+            int victim = lists[Am].popFront();
+            freeFrames.give(dir.frame[victim]);
+            dir.release(victim);
+        }
+    };
+
+    // Estado inicial: las páginas ya cargadas entran a A1in en orden de marco
+    for (int j = 0; j < c; ++j)
+    {
+        int page = sim.memory[j].pageNumber;
+        if (page != -1 && dir.find(page) == -1)
+        {
+            int n = dir.acquire(page);
+            dir.frame[n] = j;
+            dir.owner[n] = A1in;
+            lists[A1in].pushBack(n);
+        }
+    }
+
+    PackedAccess access;
+    for (size_t i = 0; accesses.next(access); ++i)
+    {
+        int page = accessPage(access);
+        bool modified = accessModified(access);
+        int n = dir.find(page);
+
+        if (n != -1 && dir.frame[n] != -1)
+        {
+            // Acierto: en Am pasa al MRU; en A1in no cambia de posición
+            touchFrame(sim, dir.frame[n], modified);
+            if (dir.owner[n] == Am)
+                lists[Am].moveToBack(n);
+            continue;
+        }
+
+        sim.pageFaults++;
+
+        // Si estaba en A1out se pidió de nuevo tras salir de A1in → página caliente. Se saca
+        // de A1out antes de liberar un marco para que el recorte de A1out no la descarte.
+        uint8_t target = A1in;
+        if (n != -1)
+        {
+            lists[A1out].remove(n);
+            target = Am;
+        }
+        reclaim();
+        if (n == -1)
+            n = dir.acquire(page);
+
+        dir.frame[n] = freeFrames.take();
+        dir.owner[n] = target;
+        lists[target].pushBack(n);
+        loadFrame(sim, dir.frame[n], page, modified);
+    }
+
+    sim.metadataBytes = dir.metadataBytes();
+}
+
+/**
+ * @brief Simula LIRS (Low Inter-reference Recency Set, Jiang y Zhang).
+ *
+ * Clasifica las páginas por su distancia de reuso (IRR): las de IRR baja forman el
+ * conjunto LIR (99% de los marcos) y las demás son HIR, con solo un 1% de marcos para las
+ * HIR residentes. La pila S guarda la recencia de páginas LIR, HIR residentes y HIR no
+ * residentes (historia), con una LIR siempre en el fondo; la cola Q guarda las HIR
+ * residentes, candidatas a reemplazo. Una página HIR pedida de nuevo mientras sigue en S
+ * tiene una IRR menor que la LIR más antigua y la desplaza. La historia no residente se
+ * limita a tantas entradas como marcos, descartando primero la más antigua.
+ *
+ * @param sim      Referencia al simulador con marcos, contador de fallos, etc.
+ * @param accesses Cursor sobre los accesos empaquetados (página y bit M por palabra).
+ */
+void runLIRS(PageReplacementSimulator &sim, AccessCursor &accesses)
+{
+    enum : uint8_t { LIR, HIR, NonResident };
+
+    const int c = sim.frameCount;
+    const int hirCapacity = (c >= 2) ? std::max(1, c / 100) : 0;
+    const int lirCapacity = c - hirCapacity;
+    const int historyCapacity = c; // Máximo de entradas HIR no residentes
+
+    PageDirectory dir(2 * c + 1);        // owner = LIR, HIR o NonResident
+    IndexLinks stackLinks(2 * c + 1);    // Enlaces de la pila S
+    IndexList stack(stackLinks);         // S: cabeza = fondo, cola = tope
+    std::vector<uint8_t> inStack(2 * c + 1, 0);
+    IndexList queue(dir.links);          // Q: HIR residentes (cabeza = próxima víctima)
+    IndexList history(dir.links);        // HIR no residentes, por antigüedad
+    FreeFrames freeFrames(sim);
+    int lirCount = 0;
+
+    auto pushTop = [&](int n) {
+        if (inStack[n])
+            stack.remove(n);
+        stack.pushBack(n);
+        inStack[n] = 1;
+    };
+
+    auto leaveStack = [&](int n) {
+        stack.remove(n);
+        inStack[n] = 0;
+        if (dir.owner[n] == NonResident)
+        {
+            history.remove(n);
+            dir.release(n);
+        }
+    };
+
+    // Poda: el fondo de S debe ser una LIR
+    auto prune = [&]() {
+        while (!stack.empty() && dir.owner[stack.head] != LIR)
+            leaveStack(stack.head);
+    };
+
+    // La LIR del fondo de S pasa a HIR residente al final de Q
+    auto demoteBottom = [&]() {
+        int n = stack.head;
+        dir.owner[n] = HIR;
+        lirCount--;
+        queue.pushBack(n);
+        leaveStack(n);
+        prune();
+    };
+
+    // Libera un marco expulsando la HIR residente más antigua de Q
+    auto evict = [&]() {
+        if (queue.empty())
+            demoteBottom();
+        int victim = queue.popFront();
+        freeFrames.give(dir.frame[victim]);
+        dir.frame[victim] = -1;
+        if (!inStack[victim])
+        {
+            dir.release(victim);
+            return;
+        }
+        // Sigue en S como historia: limitar las entradas no residentes
+        if (history.size >= historyCapacity)
+            leaveStack(history.head);
+        dir.owner[victim] = NonResident;
+        history.pushBack(victim);
+    };
+
+    // Carga una página nueva: LIR mientras haya lugar en el conjunto LIR, si no HIR
+    auto insertNew = [&](int page, int frame) {
+        int n = dir.acquire(page);
+        dir.frame[n] = frame;
+        pushTop(n);
+        if (lirCount < lirCapacity)
+        {
+            dir.owner[n] = LIR;
+            lirCount++;
+        }
+        else
+        {
+            dir.owner[n] = HIR;
+            queue.pushBack(n);
+        }
+    };
+
+    // Estado inicial: las páginas cargadas entran como si se accedieran en orden de marco
+    for (int j = 0; j < c; ++j)
+    {
+        int page = sim.memory[j].pageNumber;
+        if (page != -1 && dir.find(page) == -1)
+            insertNew(page, j);
+    }
+
+    PackedAccess access;
+    for (size_t i = 0; accesses.next(access); ++i)
+    {
+        int page = accessPage(access);
+        bool modified = accessModified(access);
+        int n = dir.find(page);
+
+        if (n != -1 && dir.owner[n] == LIR)
+        {
+            // Acierto LIR: pasa al tope de S
+            touchFrame(sim, dir.frame[n], modified);
+            bool wasBottom = (stack.head == n);
+            pushTop(n);
+            if (wasBottom)
+                prune();
+            continue;
+        }
+
+        if (n != -1 && dir.owner[n] == HIR)
+        {
+            // Acierto HIR residente
+            touchFrame(sim, dir.frame[n], modified);
+            if (inStack[n])
+            {
+                // Su IRR es menor que la recencia de la LIR del fondo: pasa a LIR
+                queue.remove(n);
+                dir.owner[n] = LIR;
+                lirCount++;
+                pushTop(n);
+                if (lirCount > lirCapacity)
+                    demoteBottom();
+            }
+            else
+            {
+                pushTop(n);
+                queue.moveToBack(n);
+            }
+            continue;
+        }
+
+        // Fallo de página
+        sim.pageFaults++;
+        if (freeFrames.empty())
+            evict();
+
+        // evict() pudo descartar la historia de esta misma página
+        n = dir.find(page);
+        int frame = freeFrames.take();
+        if (n != -1)
+        {
+            // HIR no residente todavía en S: su IRR es baja → vuelve como LIR
+            history.remove(n);
+            dir.frame[n] = frame;
+            dir.owner[n] = LIR;
+            lirCount++;
+            pushTop(n);
+            if (lirCount > lirCapacity)
+                demoteBottom();
+        }
+        else
+        {
+            insertNew(page, frame);
+        }
+        loadFrame(sim, frame, page, modified);
+    }
+
+    sim.metadataBytes = dir.metadataBytes() + stackLinks.prev.size() * 2 * sizeof(int) + inStack.size();
+}
+
+/**
+ * @brief Simula CLOCK-Pro (Jiang, Chen y Zhang), la aproximación de LIRS con reloj.
+ *
+ * Todas las páginas (calientes, frías residentes y frías no residentes en período de
+ * prueba) están en un único reloj circular recorrido por tres manecillas:
+ *  - HAND_cold busca una fría residente para expulsar; si tiene R=1 y estaba en prueba se
+ *    vuelve caliente (su distancia de reuso es corta), si no se le da un período de prueba.
+ *  - HAND_hot convierte en fría la primera caliente con R=0 y termina los períodos de
+ *    prueba que encuentra.
+ *  - HAND_test termina períodos de prueba y descarta la historia no residente, limitada a
+ *    tantas entradas como marcos.
+ * El espacio objetivo de frías residentes (mc) se adapta: crece cuando una página en
+ * prueba vuelve a pedirse tras ser expulsada y decrece cuando una prueba vence sin reuso.
+ *
+ * @param sim      Referencia al simulador con marcos, contador de fallos, etc.
+ * @param accesses Cursor sobre los accesos empaquetados (página y bit M por palabra).
+ */
+void runClockPro(PageReplacementSimulator &sim, AccessCursor &accesses)
+{
+    enum : uint8_t { Hot, Cold, NonResident };
+
+    const int m = sim.frameCount;
+    PageDirectory dir(2 * m + 1);              // owner = Hot, Cold o NonResident
+    std::vector<uint8_t> inTest(2 * m + 1, 0); // ¿Página fría en período de prueba?
+    FreeFrames freeFrames(sim);
+    IndexLinks &ring = dir.links;              // Reloj circular sobre los nodos
+    int ringSize = 0;
+    int handHot = -1, handCold = -1, handTest = -1;
+    int hotCount = 0, coldCount = 0, nonResidentCount = 0;
+    int coldTarget = 1;                        // mc: marcos objetivo para frías residentes
+
+    auto referenced = [&](int n) -> bool & { return sim.memory[dir.frame[n]].bits.R; };
+
+    // Inserta en la cabeza del reloj (justo antes de HAND_hot)
+    auto insertHead = [&](int n) {
+        if (ringSize == 0)
+        {
+            ring.prev[n] = ring.next[n] = n;
+            handHot = handCold = handTest = n;
+        }
+        else
+        {
+            int before = ring.prev[handHot];
+            ring.prev[n] = before;
+            ring.next[n] = handHot;
+            ring.next[before] = n;
+            ring.prev[handHot] = n;
+        }
+        ringSize++;
+    };
+
+    auto unlink = [&](int n) {
+        int after = (ringSize == 1) ? -1 : ring.next[n];
+        for (int *hand : {&handHot, &handCold, &handTest})
+        {
+            if (*hand == n)
+                *hand = after;
+        }
+        if (after != -1)
+        {
+            ring.next[ring.prev[n]] = after;
+            ring.prev[after] = ring.prev[n];
+        }
+        ring.prev[n] = ring.next[n] = -1;
+        ringSize--;
+    };
+
+    auto moveToHead = [&](int n) {
+        unlink(n);
+        insertHead(n);
+    };
+
+    auto expireTest = [&]() { coldTarget = std::max(1, coldTarget - 1); };
+
+    // HAND_test: termina pruebas hasta descartar una entrada no residente
+    auto runHandTest = [&]() {
+        while (true)
+        {
+            int n = handTest;
+            handTest = ring.next[n];
+            if (dir.owner[n] == NonResident)
+            {
+                unlink(n);
+                dir.release(n);
+                nonResidentCount--;
+                expireTest();
+                return;
+            }
+            if (dir.owner[n] == Cold && inTest[n])
+            {
+                inTest[n] = 0;
+                expireTest();
+            }
+        }
+    };
+
+    // HAND_hot: convierte en fría la primera caliente con R=0
+    auto runHandHot = [&]() {
+        while (true)
+        {
+            int n = handHot;
+            handHot = ring.next[n];
+            if (dir.owner[n] == Hot)
+            {
+                if (referenced(n))
+                {
+                    referenced(n) = false;
+                    continue;
+                }
+                dir.owner[n] = Cold;
+                inTest[n] = 0;
+                hotCount--;
+                coldCount++;
+                return;
+            }
+            if (dir.owner[n] == Cold && inTest[n])
+            {
+                inTest[n] = 0;
+                expireTest();
+            }
+            else if (dir.owner[n] == NonResident)
+            {
+                unlink(n);
+                dir.release(n);
+                nonResidentCount--;
+                expireTest();
+            }
+        }
+    };
+
+    auto balanceHot = [&]() {
+        while (hotCount > 0 && hotCount > m - coldTarget)
+            runHandHot();
+    };
+
+    // HAND_cold: expulsa una fría residente y libera su marco
+    auto runHandCold = [&]() {
+        while (true)
+        {
+            // Sin frías residentes la manecilla no encontraría víctima: se enfría una caliente
+            if (coldCount == 0)
+                runHandHot();
+
+            int n = handCold;
+            handCold = ring.next[n];
+            if (dir.owner[n] != Cold)
+                continue;
+
+            if (referenced(n))
+            {
+                referenced(n) = false;
+                if (inTest[n])
+                {
+                    // Reusada durante la prueba: distancia de reuso corta → caliente
+                    dir.owner[n] = Hot;
+                    inTest[n] = 0;
+                    coldCount--;
+                    hotCount++;
+                    moveToHead(n);
+                    balanceHot();
+                }
+                else
+                {
+                    inTest[n] = 1;
+                    moveToHead(n);
+                }
+                continue;
+            }
+
+            freeFrames.give(dir.frame[n]);
+            dir.frame[n] = -1;
+            coldCount--;
+            if (inTest[n])
+            {
+                // Queda como historia no residente hasta que venza su prueba
+                dir.owner[n] = NonResident;
+                nonResidentCount++;
+                if (nonResidentCount > m)
+                    runHandTest();
+            }
+            else
+            {
+                unlink(n);
+                dir.release(n);
+            }
+            return;
+        }
+    };
+
+    // Estado inicial: las páginas cargadas entran como frías en prueba en orden de marco
+    for (int j = 0; j < m; ++j)
+    {
+        int page = sim.memory[j].pageNumber;
+        if (page != -1 && dir.find(page) == -1)
+        {
+            int n = dir.acquire(page);
+            dir.frame[n] = j;
+            dir.owner[n] = Cold;
+            inTest[n] = 1;
+            coldCount++;
+            insertHead(n);
+        }
+    }
+
+    PackedAccess access;
+    for (size_t i = 0; accesses.next(access); ++i)
+    {
+        int page = accessPage(access);
+        bool modified = accessModified(access);
+        int n = dir.find(page);
+
+        if (n != -1 && dir.owner[n] != NonResident)
+        {
+            // Acierto: solo se marca el bit R
+            touchFrame(sim, dir.frame[n], modified);
+            continue;
+        }
+
+        sim.pageFaults++;
+        if (freeFrames.empty())
+            runHandCold();
+
+        // runHandCold() pudo descartar la historia de esta misma página
+        n = dir.find(page);
+        int frame = freeFrames.take();
+        if (n != -1)
+        {
+            // Fría no residente en prueba: se necesitaba más espacio para frías
+            coldTarget = std::min(m, coldTarget + 1);
+            nonResidentCount--;
+            unlink(n);
+            dir.frame[n] = frame;
+            dir.owner[n] = Hot;
+            inTest[n] = 0;
+            hotCount++;
+            insertHead(n);
+            loadFrame(sim, frame, page, modified);
+            referenced(n) = false;
+            balanceHot();
+        }
+        else
+        {
+            n = dir.acquire(page);
+            dir.frame[n] = frame;
+            dir.owner[n] = Cold;
+            inTest[n] = 1;
+            coldCount++;
+            insertHead(n);
+            loadFrame(sim, frame, page, modified);
+            referenced(n) = false;
+        }
+    }
+
+    sim.metadataBytes = dir.metadataBytes() + inTest.size();
+}
@@ -0,0 +1,173 @@
+#include "Shards.hpp"
+#include "Algorithms.hpp"
+#include "WorkStealingPool.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+
+// Cada réplica usa 16 bits distintos de un mismo hash de 64 bits de la página
+static const int SAMPLING_BITS = 16;
+
+// t de Student al 95% (dos colas) con SHARDS_REPLICAS - 1 = 3 grados de libertad
+static const double T_CRITICAL_95 = 3.182;
+
+static inline uint64_t pageHash(int page)
+{
+    uint64_t x = static_cast<uint32_t>(page) + 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+// Escala una cantidad de accesos o marcos a la muestra (al menos 1)
+static int scaleToSample(int value, double rate)
+{
+    return std::max(1, static_cast<int>(std::lround(value * rate)));
+}
+
+ShardsResult runShards(const AccessTrace &trace, int minFrames, int maxFrames,
+                       const std::vector<ReplacementAlgorithm> &algorithms, double rate,
+                       const PageReplacementSimulator &settings, unsigned threads)
+{
+    ShardsResult result;
+    result.rate = rate;
+    result.algorithms = algorithms;
+
+    // Una pasada arma las trazas muestreadas de todas las réplicas
+    uint64_t threshold = std::max<uint64_t>(1, std::llround(rate * (1u << SAMPLING_BITS)));
+    uint64_t sliceMask = (uint64_t(1) << SAMPLING_BITS) - 1;
+    std::vector<AccessTrace> samples(SHARDS_REPLICAS);
+    for (PackedAccess access : trace)
+    {
+        uint64_t hash = pageHash(accessPage(access));
+        for (int r = 0; r < SHARDS_REPLICAS; ++r)
+        {
+            if (((hash >> (r * SAMPLING_BITS)) & sliceMask) < threshold)
+                samples[r].append(&access, 1);
+        }
+    }
+
+    for (const auto &sample : samples)
+    {
+        if (sample.empty())
+        {
+            std::cerr << "Error: la muestra no tiene accesos; aumente la tasa de muestreo.\n";
+            std::exit(EXIT_FAILURE);
+        }
+        result.sampledAccesses += static_cast<double>(sample.size()) / SHARDS_REPLICAS;
+    }
+
+    // Ajuste de SHARDS: las tasas se dividen por los accesos esperados en la muestra y no
+    // por los obtenidos. La diferencia suele venir de unas pocas páginas muy usadas (que
+    // aciertan casi siempre) y dividir por lo obtenido sesga la tasa cuando caen o no caen
+    // en la muestra.
+    double expectedAccesses = static_cast<double>(trace.size()) * threshold / (1u << SAMPLING_BITS);
+
+    // Varias cantidades de marcos pueden escalar a los mismos marcos simulados
+    std::map<int, size_t> scaledIndex;
+    for (int frames = minFrames; frames <= maxFrames; ++frames)
+        scaledIndex.emplace(scaleToSample(frames, rate), 0);
+    size_t next = 0;
+    for (auto &item : scaledIndex)
+        item.second = next++;
+
+    // faults[r][s][a]: réplica r, marcos simulados s, algoritmo a
+    std::vector<std::vector<std::vector<int64_t>>> faults(
+        SHARDS_REPLICAS,
+        std::vector<std::vector<int64_t>>(scaledIndex.size(), std::vector<int64_t>(algorithms.size(), 0)));
+
+    std::vector<std::function<void()>> tasks;
+    for (int r = 0; r < SHARDS_REPLICAS; ++r)
+    {
+        for (auto it = scaledIndex.rbegin(); it != scaledIndex.rend(); ++it)
+        {
+            for (size_t a = 0; a < algorithms.size(); ++a)
+            {
+                int frames = it->first;
+                size_t s = it->second;
+                tasks.push_back([&, r, frames, s, a]() {
+                    PageReplacementSimulator sim(frames, algorithms[a]);
+                    sim.timerInterval = settings.timerInterval > 0 ? scaleToSample(settings.timerInterval, rate) : 0;
+                    sim.agingBits = settings.agingBits;
+                    sim.workingSetWindow = scaleToSample(settings.workingSetWindow, rate);
+
+                    runAlgorithm(sim, samples[r]);
+                    faults[r][s][a] = sim.pageFaults;
+                });
+            }
+        }
+    }
+
+    WorkStealingPool pool(threads);
+    pool.run(std::move(tasks));
+
+    for (int frames = minFrames; frames <= maxFrames; ++frames)
+    {
+        ShardsPoint point;
+        point.frames = frames;
+        point.scaledFrames = scaleToSample(frames, rate);
+        size_t s = scaledIndex[point.scaledFrames];
+
+        for (size_t a = 0; a < algorithms.size(); ++a)
+        {
+            double sum = 0.0, squares = 0.0;
+            for (int r = 0; r < SHARDS_REPLICAS; ++r)
+            {
+                double ratio = std::min(1.0, faults[r][s][a] / expectedAccesses);
+                sum += ratio;
+                squares += ratio * ratio;
+            }
+            double mean = sum / SHARDS_REPLICAS;
+            double variance = std::max(0.0, (squares - SHARDS_REPLICAS * mean * mean) / (SHARDS_REPLICAS - 1));
+            point.missRatio.push_back(mean);
+            point.error.push_back(T_CRITICAL_95 * std::sqrt(variance / SHARDS_REPLICAS));
+        }
+        result.points.push_back(std::move(point));
+    }
+    return result;
+}
+
+void printShards(const ShardsResult &result, size_t accessCount, const SweepResult *exact)
+{
+    for (size_t a = 0; a < result.algorithms.size(); ++a)
+    {
+        std::cout << "\n=== Estimación SHARDS de " << to_string(result.algorithms[a]) << " (tasa "
+                  << result.rate << ", " << SHARDS_REPLICAS << " réplicas, "
+                  << static_cast<long long>(result.sampledAccesses) << " accesos muestreados por réplica) ===\n";
+        std::cout << std::setw(8) << "Marcos" << std::setw(11) << "Simulados" << std::setw(16) << "Tasa estimada"
+                  << std::setw(12) << "± Error";
+        if (exact)
+            std::cout << std::setw(14) << "Tasa exacta" << std::setw(14) << "Error real";
+        std::cout << "\n";
+
+        double totalError = 0.0;
+        int inside = 0;
+        for (const auto &point : result.points)
+        {
+            std::cout << std::setw(8) << point.frames << std::setw(11) << point.scaledFrames << std::fixed
+                      << std::setprecision(4) << std::setw(16) << point.missRatio[a] << std::setw(12)
+                      << point.error[a];
+            if (exact)
+            {
+                double ratio = accessCount ? static_cast<double>(exact->faults[point.frames - exact->minFrames][a]) /
+                                                 accessCount
+                                           : 0.0;
+                double observed = std::fabs(point.missRatio[a] - ratio);
+                totalError += observed;
+                inside += observed <= point.error[a];
+                std::cout << std::setw(14) << ratio << std::setw(14) << observed;
+            }
+            std::cout << std::defaultfloat << "\n";
+        }
+
+        if (exact && !result.points.empty())
+        {
+            std::cout << "Error absoluto medio: " << std::fixed << std::setprecision(4)
+                      << totalError / result.points.size() << std::defaultfloat << " | Dentro del intervalo: "
+                      << inside << "/" << result.points.size() << "\n";
+        }
+    }
+}
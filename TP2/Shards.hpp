@@ -0,0 +1,61 @@
+#ifndef SHARDS_HPP
+#define SHARDS_HPP
+
+#include "PageReplacement.hpp"
+#include "AccessTrace.hpp"
+#include "Sweep.hpp"
+#include <vector>
+
+// Tasa de muestreo por defecto (1% de las páginas) y réplicas independientes del muestreo
+const double DEFAULT_SAMPLING_RATE = 0.01;
+const int SHARDS_REPLICAS = 4;
+
+// Estimación de una cantidad de marcos: tasa de fallos media de las réplicas por algoritmo
+struct ShardsPoint
+{
+    int frames = 0;                // Cantidad de marcos estimada
+    int scaledFrames = 0;          // Marcos simulados sobre la traza muestreada
+    std::vector<double> missRatio; // Tasa de fallos estimada, por algoritmo
+    std::vector<double> error;     // Semiancho del intervalo de confianza del 95%
+};
+
+struct ShardsResult
+{
+    double rate = 0.0;
+    double sampledAccesses = 0.0; // Accesos muestreados promedio por réplica
+    std::vector<ReplacementAlgorithm> algorithms;
+    std::vector<ShardsPoint> points;
+};
+
+/**
+ * @brief Estima las tasas de fallos de un rango de marcos simulando una muestra de páginas.
+ *
+ * Muestreo espacial al estilo SHARDS: una página entra en la muestra si su hash cae por
+ * debajo de `rate`, así que se conservan todos sus accesos (y su reuso) y se descartan
+ * los de las demás. Cada algoritmo corre sobre la traza muestreada con round(F · rate)
+ * marcos, y el temporizador y la ventana τ se escalan igual porque el tiempo virtual de
+ * la muestra avanza `rate` veces más lento. Se hacen SHARDS_REPLICAS muestras con hashes
+ * independientes; la estimación es la media de sus tasas de fallos y el error, el
+ * intervalo de confianza del 95% (t de Student) de esa media. Como en SHARDS_adj, cada
+ * tasa se calcula sobre los accesos esperados de la muestra (rate · accesos) para no
+ * sesgarla cuando una página muy usada entra o no entra en la muestra.
+ *
+ * La memoria inicial se asume vacía. Las simulaciones corren en paralelo como en el barrido.
+ *
+ * @param trace      Secuencia de accesos completa (solo lectura).
+ * @param minFrames  Menor cantidad de marcos a estimar.
+ * @param maxFrames  Mayor cantidad de marcos a estimar.
+ * @param algorithms Algoritmos de reemplazo a estimar.
+ * @param rate       Fracción de páginas muestreadas, en (0, 1].
+ * @param settings   Simulador del que se copian los parámetros de configuración.
+ * @param threads    Hilos a usar (0 = uno por núcleo).
+ */
+ShardsResult runShards(const AccessTrace &trace, int minFrames, int maxFrames,
+                       const std::vector<ReplacementAlgorithm> &algorithms, double rate,
+                       const PageReplacementSimulator &settings, unsigned threads = 0);
+
+// Imprime una tabla por algoritmo con la tasa estimada ± error; si se pasa la matriz
+// exacta del barrido (mismo rango), agrega la tasa exacta y el error observado
+void printShards(const ShardsResult &result, size_t accessCount, const SweepResult *exact = nullptr);
+
+#endif // SHARDS_HPP
@@ -0,0 +1,63 @@
+#include "Sweep.hpp"
+#include "Algorithms.hpp"
+#include "WorkStealingPool.hpp"
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+
+SweepResult runSweep(const AccessTrace &trace, const AccessTrace &initial, int minFrames, int maxFrames,
+                     const std::vector<ReplacementAlgorithm> &algorithms,
+                     const PageReplacementSimulator &settings, unsigned threads)
+{
+    SweepResult result;
+    result.minFrames = minFrames;
+    result.algorithms = algorithms;
+    result.faults.assign(maxFrames - minFrames + 1, std::vector<int64_t>(algorithms.size(), 0));
+
+    // Una tarea por celda; las de más marcos, que suelen ser las más largas, se ejecutan
+    // primero: cada hilo toma de su cola desde el final, así que se encolan de menos a más
+    std::vector<std::function<void()>> tasks;
+    for (int frames = minFrames; frames <= maxFrames; ++frames)
+    {
+        for (size_t a = 0; a < algorithms.size(); ++a)
+        {
+            tasks.push_back([&, frames, a]() {
+                PageReplacementSimulator sim(frames, algorithms[a]);
+                sim.timerInterval = settings.timerInterval;
+                sim.agingBits = settings.agingBits;
+                sim.workingSetWindow = settings.workingSetWindow;
+                sim.readFaultLatency = settings.readFaultLatency;
+                sim.writebackLatency = settings.writebackLatency;
+                loadInitialState(sim, initial);
+
+                runAlgorithm(sim, trace);
+                result.faults[frames - minFrames][a] = sim.pageFaults;
+            });
+        }
+    }
+
+    WorkStealingPool pool(threads);
+    pool.run(std::move(tasks));
+    return result;
+}
+
+void printSweep(const SweepResult &result)
+{
+    std::vector<int> widths;
+    for (ReplacementAlgorithm alg : result.algorithms)
+        widths.push_back(std::max<int>(8, to_string(alg).size() + 2));
+
+    std::cout << "\n=== Matriz de fallos (filas: marcos, columnas: algoritmos) ===\n";
+    std::cout << std::setw(8) << "Marcos";
+    for (size_t a = 0; a < result.algorithms.size(); ++a)
+        std::cout << std::setw(widths[a]) << to_string(result.algorithms[a]);
+    std::cout << "\n";
+
+    for (size_t f = 0; f < result.faults.size(); ++f)
+    {
+        std::cout << std::setw(8) << result.minFrames + static_cast<int>(f);
+        for (size_t a = 0; a < result.algorithms.size(); ++a)
+            std::cout << std::setw(widths[a]) << result.faults[f][a];
+        std::cout << "\n";
+    }
+}
@@ -0,0 +1,38 @@
+#ifndef SWEEP_HPP
+#define SWEEP_HPP
+
+#include "PageReplacement.hpp"
+#include "AccessTrace.hpp"
+#include <vector>
+
+// Matriz de fallos del barrido: faults[f][a] para minFrames + f marcos y algorithms[a]
+struct SweepResult
+{
+    int minFrames = 0;
+    std::vector<ReplacementAlgorithm> algorithms;
+    std::vector<std::vector<int64_t>> faults;
+};
+
+/**
+ * @brief Ejecuta cada par (algoritmo, cantidad de marcos) del barrido en paralelo.
+ *
+ * La traza y el estado inicial se parsean una sola vez y todos los hilos los leen sin
+ * copiarlos. Cada par corre en su propio simulador, configurado como `settings`
+ * (temporizador, bits de Aging, ventana τ, latencias), y escribe en su propia celda.
+ *
+ * @param trace      Secuencia de accesos compartida (solo lectura).
+ * @param initial    Páginas cargadas al inicio (vacía = memoria vacía).
+ * @param minFrames  Menor cantidad de marcos del barrido.
+ * @param maxFrames  Mayor cantidad de marcos del barrido.
+ * @param algorithms Algoritmos de reemplazo a comparar.
+ * @param settings   Simulador del que se copian los parámetros de configuración.
+ * @param threads    Hilos a usar (0 = uno por núcleo).
+ */
+SweepResult runSweep(const AccessTrace &trace, const AccessTrace &initial, int minFrames, int maxFrames,
+                     const std::vector<ReplacementAlgorithm> &algorithms,
+                     const PageReplacementSimulator &settings, unsigned threads = 0);
+
+// Imprime la matriz de fallos: una fila por cantidad de marcos, una columna por algoritmo
+void printSweep(const SweepResult &result);
+
+#endif // SWEEP_HPP
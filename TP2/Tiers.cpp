@@ -0,0 +1,275 @@
+#include "Tiers.hpp"
+#include "Algorithms.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <unordered_set>
+
+bool parseTiers(const std::string &text, std::vector<MemoryTier> &tiers)
+{
+    tiers.clear();
+    std::istringstream list(text);
+    std::string item;
+    while (std::getline(list, item, ';'))
+    {
+        std::istringstream fields(item);
+        std::string frames, name, latency;
+        MemoryTier tier;
+        try
+        {
+            if (!std::getline(fields, frames, ':') || !std::getline(fields, name, ':') ||
+                !std::getline(fields, latency))
+                throw std::invalid_argument(item);
+            name.erase(0, name.find_first_not_of(" \t"));
+            name.erase(name.find_last_not_of(" \t") + 1);
+            tier.frames = std::stoi(frames);
+            tier.algorithm = parseAlgorithm(name);
+            tier.latency = std::stod(latency);
+        }
+        catch (...)
+        {
+            std::cerr << "Error: nivel inválido (se espera marcos:algoritmo:latencia): " << item << std::endl;
+            return false;
+        }
+
+        bool replacement = std::find(std::begin(REPLACEMENT_ALGORITHMS), std::end(REPLACEMENT_ALGORITHMS),
+                                     tier.algorithm) != std::end(REPLACEMENT_ALGORITHMS);
+        if (!replacement || tier.algorithm == ReplacementAlgorithm::OPT || tier.frames < 1 || tier.latency < 0)
+        {
+            std::cerr << "Error: nivel inválido (marcos positivos y un algoritmo de reemplazo distinto de OPT): "
+                      << item << std::endl;
+            return false;
+        }
+        tiers.push_back(tier);
+    }
+    return true;
+}
+
+/**
+ * @brief Entrega a un nivel sus eventos y recoge los que pasa al siguiente.
+ *
+ * Como en el prefetch, entrega un evento por bloque para ver, antes del siguiente, si el
+ * anterior falló y qué páginas desalojó (el registro de desalojos del simulador). Los
+ * niveles de abajo llevan el conjunto de sus páginas residentes para no entregar al
+ * algoritmo las búsquedas que no están: esas pasan directo al siguiente nivel.
+ */
+class TierStage : public ChunkSource
+{
+public:
+    TierStage(const std::vector<TierEvent> &events, PageReplacementSimulator &sim, std::vector<PackedAccess> &log,
+              std::vector<TierEvent> &out, TierStats &stats, bool top)
+        : pos(events.data()), last(events.data() + events.size()), sim(sim), log(log), out(out), stats(stats),
+          top(top)
+    {
+    }
+
+    bool nextChunk(const PackedAccess *&begin, const PackedAccess *&end) override
+    {
+        if (delivered)
+            settle();
+
+        while (pos != last)
+        {
+            const TierEvent &event = *pos++;
+            int page = accessPage(event.access);
+            if (event.store)
+            {
+                stats.stores++;
+                resident.insert(page);
+            }
+            else
+            {
+                stats.lookups++;
+                if (!top && !resident.count(page))
+                {
+                    out.push_back(event);
+                    continue;
+                }
+            }
+
+            current = event;
+            faultsBefore = sim.pageFaults;
+            delivered = true;
+            begin = &current.access;
+            end = &current.access + 1;
+            return true;
+        }
+        return false;
+    }
+
+private:
+    // Contabiliza el evento entregado: si una búsqueda falló (solo en la DRAM) sigue hacia
+    // abajo, y las páginas desalojadas bajan como guardados
+    void settle()
+    {
+        delivered = false;
+        if (!current.store)
+        {
+            if (sim.pageFaults == faultsBefore)
+                stats.hits++;
+            else
+                out.push_back({packAccess(accessPage(current.access), false), false});
+        }
+        for (PackedAccess evicted : log)
+        {
+            if (!top)
+                resident.erase(accessPage(evicted));
+            out.push_back({evicted, true});
+            stats.evictions++;
+        }
+        log.clear();
+    }
+
+    const TierEvent *pos;
+    const TierEvent *last;
+    PageReplacementSimulator &sim;
+    std::vector<PackedAccess> &log;
+    std::vector<TierEvent> &out;
+    TierStats &stats;
+    bool top;                         // ¿Es la DRAM? (carga toda búsqueda que falla)
+    TierEvent current = {0, false};   // Evento entregado en el último bloque
+    bool delivered = false;
+    int64_t faultsBefore = 0;
+    std::unordered_set<int> resident; // Páginas del nivel (solo niveles de abajo)
+};
+
+// Simula un nivel sobre los eventos del de arriba; sin marcos, todo pasa de largo
+static TierStats runTier(const MemoryTier &tier, const std::vector<TierEvent> &events, std::vector<TierEvent> &out,
+                         const PageReplacementSimulator &settings, const AccessTrace *initial)
+{
+    TierStats stats;
+    stats.tier = tier;
+    out.clear();
+    if (tier.frames == 0)
+    {
+        for (const TierEvent &event : events)
+        {
+            (event.store ? stats.stores : stats.lookups)++;
+            stats.evictions += event.store;
+        }
+        out = events;
+        return stats;
+    }
+
+    PageReplacementSimulator sim(tier.frames, tier.algorithm);
+    sim.timerInterval = settings.timerInterval;
+    sim.agingBits = settings.agingBits;
+    sim.workingSetWindow = settings.workingSetWindow;
+    if (initial)
+        loadInitialState(sim, *initial);
+
+    std::vector<PackedAccess> log;
+    sim.evictionLog = &log;
+    TierStage stage(events, sim, log, out, stats, initial != nullptr);
+    AccessCursor accesses(stage);
+    runAlgorithm(sim, accesses);
+    return stats;
+}
+
+// Niveles bajo la DRAM a partir de sus eventos; completa el disco y el tiempo efectivo
+static TieredResult runLower(const TierStats &dramStats, const std::vector<TierEvent> &dramOut,
+                             const std::vector<MemoryTier> &lower, const PageReplacementSimulator &settings,
+                             size_t accesses)
+{
+    TieredResult result;
+    result.accesses = accesses;
+    result.tiers.push_back(dramStats);
+
+    std::vector<TierEvent> events = dramOut;
+    std::vector<TierEvent> next;
+    double latency = 0.0;
+    for (const MemoryTier &tier : lower)
+    {
+        result.tiers.push_back(runTier(tier, events, next, settings, nullptr));
+        latency += result.tiers.back().hits * tier.latency;
+        events.swap(next);
+    }
+
+    for (const TierEvent &event : events)
+    {
+        if (!event.store)
+            result.diskReads++;
+        else if (accessModified(event.access))
+            result.diskWrites++;
+    }
+    latency += result.diskReads * settings.readFaultLatency + result.diskWrites * settings.writebackLatency;
+    result.eat = MEMORY_ACCESS_US + (accesses ? latency / accesses : 0.0);
+    return result;
+}
+
+// La DRAM recibe toda la traza como búsquedas
+static TierStats runDram(const AccessTrace &trace, const AccessTrace &initial, const MemoryTier &dram,
+                         const PageReplacementSimulator &settings, std::vector<TierEvent> &out)
+{
+    std::vector<TierEvent> events;
+    events.reserve(trace.size());
+    for (PackedAccess access : trace)
+        events.push_back({access, false});
+    return runTier(dram, events, out, settings, &initial);
+}
+
+TieredResult runTiered(const AccessTrace &trace, const AccessTrace &initial, const MemoryTier &dram,
+                       const std::vector<MemoryTier> &lower, const PageReplacementSimulator &settings)
+{
+    std::vector<TierEvent> dramOut;
+    TierStats dramStats = runDram(trace, initial, dram, settings, dramOut);
+    return runLower(dramStats, dramOut, lower, settings, trace.size());
+}
+
+std::vector<TierSizingPoint> sizeFirstTier(const AccessTrace &trace, const AccessTrace &initial,
+                                           const MemoryTier &dram, const std::vector<MemoryTier> &lower,
+                                           const PageReplacementSimulator &settings)
+{
+    std::vector<TierSizingPoint> points;
+    if (lower.empty())
+        return points;
+
+    std::vector<TierEvent> dramOut;
+    TierStats dramStats = runDram(trace, initial, dram, settings, dramOut);
+    for (double factor : TIER_SIZING_FACTORS)
+    {
+        std::vector<MemoryTier> scaled = lower;
+        scaled.front().frames = static_cast<int>(std::lround(lower.front().frames * factor));
+        points.push_back({scaled.front().frames, runLower(dramStats, dramOut, scaled, settings, trace.size())});
+    }
+    return points;
+}
+
+void printTiered(const TieredResult &result, const std::vector<TierSizingPoint> &sizing)
+{
+    std::cout << "\n=== Niveles de memoria (" << result.accesses << " accesos) ===\n";
+    std::cout << std::left << std::setw(9) << "Nivel" << std::right << std::setw(9) << "Marcos" << std::setw(14)
+              << "Algoritmo" << std::setw(16) << "Latencia (µs)" << std::setw(13) << "Búsquedas" << std::setw(11)
+              << "Aciertos" << std::setw(18) << "Tasa de aciertos" << std::setw(11) << "Recibidas" << std::setw(10)
+              << "Bajadas" << "\n";
+    for (size_t k = 0; k < result.tiers.size(); ++k)
+    {
+        const TierStats &row = result.tiers[k];
+        double rate = row.lookups ? static_cast<double>(row.hits) / row.lookups : 0.0;
+        std::cout << std::left << std::setw(9) << (k == 0 ? std::string("DRAM") : "Nivel " + std::to_string(k))
+                  << std::right << std::setw(9) << row.tier.frames << std::setw(14) << to_string(row.tier.algorithm)
+                  << std::setw(15) << (k == 0 ? MEMORY_ACCESS_US : row.tier.latency) << std::setw(12) << row.lookups
+                  << std::setw(11) << row.hits << std::setw(18) << std::fixed << std::setprecision(4) << rate
+                  << std::defaultfloat << std::setw(11) << row.stores << std::setw(10) << row.evictions << "\n";
+    }
+    std::cout << "Disco: " << result.diskReads << " lecturas, " << result.diskWrites << " escrituras\n";
+    std::cout << "EAT: " << std::fixed << std::setprecision(2) << result.eat << std::defaultfloat << " µs\n";
+
+    if (sizing.empty())
+        return;
+    std::cout << "\n--- Dimensionamiento del nivel 1 ---\n";
+    std::cout << std::setw(9) << "Marcos" << std::setw(11) << "Aciertos" << std::setw(18) << "Tasa de aciertos"
+              << std::setw(19) << "Lecturas de disco" << std::setw(20) << "Escrituras a disco" << std::setw(13)
+              << "EAT (µs)" << "\n";
+    for (const auto &point : sizing)
+    {
+        const TierStats &tier = point.result.tiers[1];
+        double rate = tier.lookups ? static_cast<double>(tier.hits) / tier.lookups : 0.0;
+        std::cout << std::setw(9) << point.frames << std::setw(11) << tier.hits << std::setw(18) << std::fixed
+                  << std::setprecision(4) << rate << std::defaultfloat << std::setw(19) << point.result.diskReads
+                  << std::setw(20) << point.result.diskWrites << std::fixed << std::setprecision(2) << std::setw(12)
+                  << point.result.eat << std::defaultfloat << "\n";
+    }
+}
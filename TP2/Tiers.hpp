@@ -0,0 +1,93 @@
+#ifndef TIERS_HPP
+#define TIERS_HPP
+
+#include "PageReplacement.hpp"
+#include "AccessTrace.hpp"
+#include <string>
+#include <vector>
+
+// Latencia por defecto (µs) de un acierto en el nivel comprimido: descomprimir una página
+const double DEFAULT_COMPRESSED_US = 5.0;
+
+// Capacidades del primer nivel bajo la DRAM que se comparan para dimensionarlo (veces la indicada)
+const double TIER_SIZING_FACTORS[] = {0.0, 0.25, 0.5, 1.0, 2.0, 4.0};
+
+// Un nivel de memoria: capacidad en páginas, política de reemplazo y latencia de un acierto
+struct MemoryTier
+{
+    int frames = 0;
+    ReplacementAlgorithm algorithm = ReplacementAlgorithm::LRU;
+    double latency = 0.0; // µs
+};
+
+// Parsea los niveles bajo la DRAM como "marcos:algoritmo:latencia;..." (ej. "64:LRU:5");
+// false (con mensaje) si alguno es inválido. OPT no se admite: los niveles se recorren en
+// una sola pasada.
+bool parseTiers(const std::string &text, std::vector<MemoryTier> &tiers);
+
+// Evento que un nivel pasa al siguiente: una búsqueda (fallo del nivel de arriba) o un
+// guardado (página que desalojó, con su bit M)
+struct TierEvent
+{
+    PackedAccess access;
+    bool store;
+};
+
+// Lo que pasó en un nivel
+struct TierStats
+{
+    MemoryTier tier;
+    size_t lookups = 0;   // Búsquedas (en la DRAM, todos los accesos)
+    size_t hits = 0;      // Búsquedas resueltas en el nivel
+    size_t stores = 0;    // Páginas recibidas del nivel de arriba
+    size_t evictions = 0; // Páginas pasadas al nivel de abajo
+};
+
+struct TieredResult
+{
+    std::vector<TierStats> tiers; // La DRAM primero
+    size_t accesses = 0;
+    size_t diskReads = 0;         // Búsquedas que no resolvió ningún nivel
+    size_t diskWrites = 0;        // Páginas modificadas desalojadas del último nivel
+    double eat = 0.0;             // Tiempo efectivo de acceso (µs)
+};
+
+// Un punto del dimensionamiento del primer nivel bajo la DRAM
+struct TierSizingPoint
+{
+    int frames = 0;
+    TieredResult result;
+};
+
+/**
+ * @brief Simula una jerarquía de memoria: DRAM, niveles intermedios (como zswap) y disco.
+ *
+ * Cada nivel corre un algoritmo de reemplazo existente con su capacidad. La DRAM recibe la
+ * traza; cada fallo busca la página en los niveles de abajo, en orden, y cada página que
+ * un nivel desaloja baja al siguiente. Un acierto en un nivel intermedio sube la página a
+ * la DRAM sin quitarla del nivel (la copia comprimida se conserva hasta desalojarse). Lo que
+ * no se encuentra en ningún nivel se lee de disco, y solo las páginas modificadas que
+ * desaloja el último nivel se escriben.
+ *
+ * Como un nivel no influye en los de arriba, se simulan uno tras otro: cada uno recorre los
+ * eventos del anterior (una búsqueda solo se le entrega al algoritmo si la página está en
+ * el nivel) y produce los del siguiente.
+ *
+ * @param trace    Secuencia de accesos.
+ * @param initial  Páginas cargadas en la DRAM al inicio.
+ * @param dram     DRAM (la latencia de sus aciertos es la del acceso a memoria).
+ * @param lower    Niveles bajo la DRAM, del más rápido al más lento.
+ * @param settings Simulador del que se copian el temporizador, la ventana τ y las latencias de disco.
+ */
+TieredResult runTiered(const AccessTrace &trace, const AccessTrace &initial, const MemoryTier &dram,
+                       const std::vector<MemoryTier> &lower, const PageReplacementSimulator &settings);
+
+// Repite la simulación con el primer nivel bajo la DRAM escalado por TIER_SIZING_FACTORS
+std::vector<TierSizingPoint> sizeFirstTier(const AccessTrace &trace, const AccessTrace &initial,
+                                           const MemoryTier &dram, const std::vector<MemoryTier> &lower,
+                                           const PageReplacementSimulator &settings);
+
+// Imprime el detalle por nivel, la latencia total y, si hay, el dimensionamiento
+void printTiered(const TieredResult &result, const std::vector<TierSizingPoint> &sizing);
+
+#endif // TIERS_HPP
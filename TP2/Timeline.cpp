@@ -0,0 +1,184 @@
+#include "Timeline.hpp"
+#include "Algorithms.hpp"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+TimelineStage::TimelineStage(const AccessTrace &trace, const PageReplacementSimulator &sim, Timeline &timeline)
+    : first(trace.begin()), pos(trace.begin()), last(trace.end()), sim(sim), timeline(timeline)
+{
+}
+
+bool TimelineStage::nextChunk(const PackedAccess *&begin, const PackedAccess *&end)
+{
+    if (delivered)
+        settle();
+    if (pos == last)
+        return false;
+
+    const PackedAccess *stop = pos + std::min<size_t>(timeline.window, last - pos);
+    current = TimelineSample();
+    current.start = pos - first;
+    current.accesses = static_cast<int>(stop - pos);
+    for (const PackedAccess *a = pos; a != stop; ++a)
+    {
+        auto seen = lastWindow.emplace(accessPage(*a), windowIndex);
+        if (seen.second || seen.first->second != windowIndex)
+        {
+            seen.first->second = windowIndex;
+            current.distinctPages++;
+        }
+    }
+
+    // Contadores al empezar la ventana; settle() guarda las diferencias
+    current.faults = sim.pageFaults;
+    current.cleanEvictions = sim.cleanEvictions;
+    current.dirtyEvictions = sim.dirtyEvictions;
+
+    begin = pos;
+    end = stop;
+    pos = stop;
+    delivered = true;
+    return true;
+}
+
+void TimelineStage::settle()
+{
+    delivered = false;
+    current.faults = sim.pageFaults - current.faults;
+    current.cleanEvictions = sim.cleanEvictions - current.cleanEvictions;
+    current.dirtyEvictions = sim.dirtyEvictions - current.dirtyEvictions;
+    timeline.samples.push(current);
+    windowIndex++;
+}
+
+void recordTimeline(PageReplacementSimulator &sim, const AccessTrace &trace, Timeline &timeline)
+{
+    TimelineStage stage(trace, sim, timeline);
+    AccessCursor accesses(stage);
+    runAlgorithm(sim, accesses);
+}
+
+// Tasa de fallos de la ventana
+static double faultRate(const TimelineSample &sample)
+{
+    return sample.accesses ? static_cast<double>(sample.faults) / sample.accesses : 0.0;
+}
+
+// Fracción de los marcos recambiada en la ventana (páginas desalojadas / marcos)
+static double churn(const TimelineSample &sample, int frames)
+{
+    return frames ? static_cast<double>(sample.cleanEvictions + sample.dirtyEvictions) / frames : 0.0;
+}
+
+static bool endsWith(const std::string &text, const std::string &suffix)
+{
+    return text.size() >= suffix.size() && text.compare(text.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+bool writeTimeline(const Timeline &timeline, const std::string &path)
+{
+    std::ofstream out(path);
+    if (!out)
+        return false;
+
+    const SampleRing &samples = timeline.samples;
+    size_t firstWindow = samples.droppedCount();
+    out << std::fixed << std::setprecision(6);
+    if (endsWith(path, ".json"))
+    {
+        out << "{\n  \"algoritmo\": \"" << to_string(timeline.algorithm) << "\",\n  \"marcos\": " << timeline.frames
+            << ",\n  \"ventana\": " << timeline.window << ",\n  \"descartadas\": " << samples.droppedCount()
+            << ",\n  \"muestras\": [";
+        for (size_t k = 0; k < samples.size(); ++k)
+        {
+            const TimelineSample &s = samples[k];
+            out << (k ? ",\n" : "\n") << "    {\"ventana\": " << firstWindow + k << ", \"inicio\": " << s.start
+                << ", \"accesos\": " << s.accesses << ", \"fallos\": " << s.faults
+                << ", \"aciertos\": " << s.accesses - s.faults << ", \"tasa_fallos\": " << faultRate(s)
+                << ", \"desalojos_limpios\": " << s.cleanEvictions << ", \"desalojos_sucios\": " << s.dirtyEvictions
+                << ", \"recambio\": " << churn(s, timeline.frames) << ", \"paginas_distintas\": " << s.distinctPages
+                << "}";
+        }
+        out << "\n  ]\n}\n";
+    }
+    else
+    {
+        out << "ventana,inicio,accesos,fallos,aciertos,tasa_fallos,desalojos_limpios,desalojos_sucios,recambio,"
+               "paginas_distintas\n";
+        for (size_t k = 0; k < samples.size(); ++k)
+        {
+            const TimelineSample &s = samples[k];
+            out << firstWindow + k << ',' << s.start << ',' << s.accesses << ',' << s.faults << ','
+                << s.accesses - s.faults << ',' << faultRate(s) << ',' << s.cleanEvictions << ','
+                << s.dirtyEvictions << ',' << churn(s, timeline.frames) << ',' << s.distinctPages << '\n';
+        }
+    }
+    return static_cast<bool>(out);
+}
+
+void printTimeline(const Timeline &timeline, bool allWindows)
+{
+    const SampleRing &samples = timeline.samples;
+    std::cout << "\n=== Serie temporal (" << to_string(timeline.algorithm) << ", ventanas de " << timeline.window
+              << " accesos) ===\n";
+    std::cout << "Ventanas: " << samples.size();
+    if (samples.droppedCount())
+        std::cout << " (se descartaron las " << samples.droppedCount() << " más antiguas)";
+    std::cout << "\n";
+    if (samples.size() == 0)
+        return;
+
+    size_t firstWindow = samples.droppedCount();
+    size_t low = 0, high = 0;
+    for (size_t k = 1; k < samples.size(); ++k)
+    {
+        if (faultRate(samples[k]) < faultRate(samples[low]))
+            low = k;
+        if (faultRate(samples[k]) > faultRate(samples[high]))
+            high = k;
+    }
+    std::cout << std::fixed << std::setprecision(4);
+    std::cout << "Tasa de fallos mínima: " << faultRate(samples[low]) << " (ventana " << firstWindow + low
+              << ", acceso " << samples[low].start << ")\n";
+    std::cout << "Tasa de fallos máxima: " << faultRate(samples[high]) << " (ventana " << firstWindow + high
+              << ", acceso " << samples[high].start << ")\n";
+
+    // Saltos de la tasa de fallos entre ventanas seguidas: cambios de fase del programa
+    int changes = 0;
+    for (size_t k = 1; k < samples.size(); ++k)
+    {
+        double before = faultRate(samples[k - 1]);
+        double after = faultRate(samples[k]);
+        if (std::fabs(after - before) < PHASE_CHANGE_DELTA)
+            continue;
+        if (changes++ == 0)
+            std::cout << "Cambios de fase (la tasa de fallos varía " << PHASE_CHANGE_DELTA << " o más):\n";
+        if (changes <= MAX_PHASE_CHANGES_SHOWN)
+            std::cout << "  Acceso " << samples[k].start << " (ventana " << firstWindow + k << "): " << before
+                      << " -> " << after << "\n";
+    }
+    if (changes > MAX_PHASE_CHANGES_SHOWN)
+        std::cout << "  ... y " << changes - MAX_PHASE_CHANGES_SHOWN << " más\n";
+    if (changes == 0)
+        std::cout << "Sin cambios de fase (la tasa de fallos nunca varía " << PHASE_CHANGE_DELTA
+                  << " o más entre ventanas seguidas)\n";
+
+    if (allWindows)
+    {
+        std::cout << "\n" << std::setw(8) << "Ventana" << std::setw(10) << "Inicio" << std::setw(9) << "Fallos"
+                  << std::setw(10) << "Aciertos" << std::setw(13) << "Tasa fallos" << std::setw(9) << "Limpios"
+                  << std::setw(8) << "Sucios" << std::setw(10) << "Recambio" << std::setw(11) << "Distintas" << "\n";
+        for (size_t k = 0; k < samples.size(); ++k)
+        {
+            const TimelineSample &s = samples[k];
+            std::cout << std::setw(8) << firstWindow + k << std::setw(10) << s.start << std::setw(9) << s.faults
+                      << std::setw(10) << s.accesses - s.faults << std::setw(13) << faultRate(s) << std::setw(9)
+                      << s.cleanEvictions << std::setw(8) << s.dirtyEvictions << std::setw(10)
+                      << churn(s, timeline.frames) << std::setw(11) << s.distinctPages << "\n";
+        }
+    }
+    std::cout << std::defaultfloat;
+}
@@ -0,0 +1,114 @@
+#ifndef TIMELINE_HPP
+#define TIMELINE_HPP
+
+#include "PageReplacement.hpp"
+#include "AccessTrace.hpp"
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Accesos por ventana de la serie temporal
+const int DEFAULT_TIMELINE_WINDOW = 1000;
+
+// Ventanas que guarda la serie; al llenarse se pisan las más antiguas
+const size_t DEFAULT_TIMELINE_CAPACITY = 4096;
+
+// Diferencia de tasa de fallos entre dos ventanas seguidas que se informa como cambio de fase
+const double PHASE_CHANGE_DELTA = 0.2;
+
+// Cambios de fase que se listan en pantalla (el archivo de la serie los tiene todos)
+const int MAX_PHASE_CHANGES_SHOWN = 20;
+
+// Lo que pasó en una ventana de accesos
+struct TimelineSample
+{
+    size_t start = 0;         // Primer acceso de la ventana
+    int accesses = 0;
+    int64_t faults = 0;       // Diferencias de contadores del simulador
+    int64_t cleanEvictions = 0;
+    int64_t dirtyEvictions = 0;
+    int distinctPages = 0;    // Páginas distintas referenciadas (conjunto de trabajo de la ventana)
+};
+
+// Buffer circular de muestras de capacidad fija, reservado al crearse
+class SampleRing
+{
+public:
+    explicit SampleRing(size_t capacity) : slots(capacity) {}
+
+    void push(const TimelineSample &sample)
+    {
+        slots[(first + count) % slots.size()] = sample;
+        if (count < slots.size())
+            count++;
+        else
+        {
+            first = (first + 1) % slots.size();
+            dropped++;
+        }
+    }
+
+    size_t size() const { return count; }
+    size_t droppedCount() const { return dropped; }
+
+    // k-ésima muestra guardada, de la más antigua a la más nueva
+    const TimelineSample &operator[](size_t k) const { return slots[(first + k) % slots.size()]; }
+
+private:
+    std::vector<TimelineSample> slots;
+    size_t first = 0;
+    size_t count = 0;
+    size_t dropped = 0; // Muestras pisadas por haberse llenado el buffer
+};
+
+// Serie temporal de una simulación
+struct Timeline
+{
+    ReplacementAlgorithm algorithm;
+    int frames = 0;
+    int window = 0;
+    SampleRing samples;
+
+    Timeline(ReplacementAlgorithm algorithm, int frames, int window, size_t capacity)
+        : algorithm(algorithm), frames(frames), window(window), samples(capacity) {}
+};
+
+/**
+ * @brief Etapa que entrega la traza al algoritmo de a una ventana por bloque.
+ *
+ * Cuando el algoritmo pide el bloque siguiente ya procesó la ventana anterior, así que los
+ * contadores del simulador (fallos, desalojos limpios y sucios) dan sus diferencias sin
+ * tocar ningún algoritmo: el costo es una muestra por ventana más contar las páginas
+ * distintas de cada una. Sin serie temporal la traza se recorre directo y no cuesta nada.
+ */
+class TimelineStage : public ChunkSource
+{
+public:
+    TimelineStage(const AccessTrace &trace, const PageReplacementSimulator &sim, Timeline &timeline);
+
+    bool nextChunk(const PackedAccess *&begin, const PackedAccess *&end) override;
+
+private:
+    void settle();
+
+    const PackedAccess *first;
+    const PackedAccess *pos;
+    const PackedAccess *last;
+    const PageReplacementSimulator &sim;
+    Timeline &timeline;
+    TimelineSample current;                   // Ventana entregada en el último bloque
+    bool delivered = false;
+    size_t windowIndex = 0;
+    std::unordered_map<int, size_t> lastWindow; // Página → última ventana en que se vio
+};
+
+// Simula el algoritmo de `sim` sobre la traza registrando la serie por ventanas (no admite OPT)
+void recordTimeline(PageReplacementSimulator &sim, const AccessTrace &trace, Timeline &timeline);
+
+// Escribe la serie en CSV, o en JSON si la ruta termina en ".json"; false si no pudo
+bool writeTimeline(const Timeline &timeline, const std::string &path);
+
+// Imprime la tasa de fallos mínima y máxima, los cambios de fase y, si se pide, cada ventana
+void printTimeline(const Timeline &timeline, bool allWindows);
+
+#endif // TIMELINE_HPP
@@ -0,0 +1,283 @@
+#include "Algorithms.hpp"
+#include "PageDirectory.hpp"
+#include <algorithm>
+#include <cstdint>
+
+// Mezcla de bits (splitmix64) para derivar los índices del sketch y del filtro
+static inline uint64_t mixHash(uint64_t x)
+{
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+// Menor potencia de dos mayor o igual a n
+static size_t nextPowerOfTwo(size_t n)
+{
+    size_t p = 1;
+    while (p < n)
+        p <<= 1;
+    return p;
+}
+
+/**
+ * @brief Count-min sketch de 4 filas con contadores saturados en 15 (4 bits útiles).
+ *
+ * Estima la frecuencia de una página como el mínimo de sus 4 contadores. Su tamaño
+ * depende solo de la cantidad de marcos, no de la cantidad de páginas distintas vistas.
+ */
+struct CountMinSketch
+{
+    static const int DEPTH = 4;
+    static const uint8_t MAX_COUNT = 15;
+
+    std::vector<uint8_t> counters; // DEPTH filas de `width` contadores
+    size_t mask;
+
+    explicit CountMinSketch(size_t width)
+        : counters(DEPTH * width, 0), mask(width - 1) {}
+
+    size_t slot(int row, int page) const
+    {
+        uint64_t h = mixHash(static_cast<uint32_t>(page) + (uint64_t(row) << 32));
+        return row * (mask + 1) + (h & mask);
+    }
+
+    int estimate(int page) const
+    {
+        int result = MAX_COUNT;
+        for (int row = 0; row < DEPTH; ++row)
+            result = std::min<int>(result, counters[slot(row, page)]);
+        return result;
+    }
+
+    void increment(int page)
+    {
+        for (int row = 0; row < DEPTH; ++row)
+        {
+            uint8_t &c = counters[slot(row, page)];
+            if (c < MAX_COUNT)
+                c++;
+        }
+    }
+
+    // Envejecimiento: divide todos los contadores a la mitad
+    void halve()
+    {
+        for (uint8_t &c : counters)
+            c >>= 1;
+    }
+};
+
+/**
+ * @brief Doorkeeper: filtro de Bloom que absorbe el primer acceso de cada página.
+ *
+ * Las páginas vistas una sola vez (la mayoría en un recorrido) no llegan a ocupar
+ * contadores del sketch.
+ */
+struct Doorkeeper
+{
+    std::vector<uint64_t> bits;
+    size_t mask;
+
+    explicit Doorkeeper(size_t bitCount) : bits(bitCount / 64, 0), mask(bitCount - 1) {}
+
+    size_t bit(int k, int page) const
+    {
+        return mixHash(static_cast<uint32_t>(page) ^ (uint64_t(k + 0x51) << 40)) & mask;
+    }
+
+    bool contains(int page) const
+    {
+        for (int k = 0; k < 2; ++k)
+        {
+            size_t b = bit(k, page);
+            if (!((bits[b >> 6] >> (b & 63)) & 1))
+                return false;
+        }
+        return true;
+    }
+
+    void insert(int page)
+    {
+        for (int k = 0; k < 2; ++k)
+        {
+            size_t b = bit(k, page);
+            bits[b >> 6] |= uint64_t(1) << (b & 63);
+        }
+    }
+
+    void clear() { std::fill(bits.begin(), bits.end(), 0); }
+};
+
+/**
+ * @brief Estimador de frecuencia TinyLFU: doorkeeper + count-min sketch con reinicio.
+ *
+ * Cada `sampleSize` registros (10 por marco) los contadores se dividen a la mitad y el
+ * doorkeeper se vacía, de modo que la frecuencia refleja el pasado reciente y la memoria
+ * usada es constante sin importar el largo de la traza.
+ */
+struct FrequencySketch
+{
+    CountMinSketch sketch;
+    Doorkeeper doorkeeper;
+    long long additions = 0;
+    long long sampleSize;
+
+    explicit FrequencySketch(int frameCount)
+        : sketch(nextPowerOfTwo(std::max(16, frameCount))),
+          doorkeeper(nextPowerOfTwo(std::max(64, 8 * frameCount))),
+          sampleSize(10LL * std::max(1, frameCount)) {}
+
+    void record(int page)
+    {
+        if (!doorkeeper.contains(page))
+            doorkeeper.insert(page);
+        else
+            sketch.increment(page);
+
+        if (++additions >= sampleSize)
+        {
+            sketch.halve();
+            doorkeeper.clear();
+            additions /= 2;
+        }
+    }
+
+    int frequency(int page) const
+    {
+        return sketch.estimate(page) + (doorkeeper.contains(page) ? 1 : 0);
+    }
+
+    size_t bytes() const
+    {
+        return sketch.counters.size() * sizeof(uint8_t) + doorkeeper.bits.size() * sizeof(uint64_t);
+    }
+};
+
+/**
+ * @brief Simula W-TinyLFU (Einziger, Friedman y Manes).
+ *
+ * Las páginas nuevas entran a una ventana LRU pequeña (1% de los marcos). Cuando la
+ * ventana se llena, su LRU es candidata a entrar a la región principal (SLRU con 80%
+ * protegida y el resto a prueba) y solo es admitida si TinyLFU estima que es más frecuente
+ * que la víctima de la región principal; si no, la candidata es la expulsada. Así, un
+ * recorrido de páginas de un solo uso no desplaza a las páginas frecuentes, y la historia
+ * de frecuencias ocupa memoria constante en lugar de crecer con cada página distinta.
+ *
+ * @param sim      Referencia al simulador con marcos, contador de fallos, etc.
+ * @param accesses Cursor sobre los accesos empaquetados (página y bit M por palabra).
+ */
+void runWTinyLFU(PageReplacementSimulator &sim, AccessCursor &accesses)
+{
+    enum : uint8_t { Window, Probation, Protected };
+
+    const int c = sim.frameCount;
+    const int windowCapacity = std::max(1, c / 100);
+    const int mainCapacity = c - windowCapacity;
+    const int protectedCapacity = mainCapacity * 8 / 10;
+
+    PageDirectory dir(c + 1);
+    IndexList lists[3] = {IndexList(dir.links), IndexList(dir.links), IndexList(dir.links)};
+    FreeFrames freeFrames(sim);
+    FrequencySketch frequencies(c);
+
+    auto moveTo = [&](int n, uint8_t target) {
+        lists[dir.owner[n]].remove(n);
+        dir.owner[n] = target;
+        lists[target].pushBack(n);
+    };
+
+    auto evict = [&](int n) {
+        lists[dir.owner[n]].remove(n);
+        freeFrames.give(dir.frame[n]);
+        dir.release(n);
+    };
+
+    // Hace lugar para una página nueva en la ventana (memoria llena)
+    auto makeRoom = [&]() {
+        if (lists[Window].size < windowCapacity || mainCapacity == 0)
+        {
+            int victim = !lists[Window].empty() && mainCapacity == 0 ? lists[Window].head
+                         : !lists[Probation].empty()                 ? lists[Probation].head
+                                                                     : lists[Protected].head;
+            evict(victim);
+            return;
+        }
+
+        // La ventana está llena: su LRU compite con la víctima de la región principal
+        int candidate = lists[Window].head;
+        if (lists[Probation].size + lists[Protected].size < mainCapacity)
+        {
+            moveTo(candidate, Probation);
+            evict(lists[Probation].empty() ? lists[Protected].head : lists[Probation].head);
+            return;
+        }
+        int victim = !lists[Probation].empty() ? lists[Probation].head : lists[Protected].head;
+        if (frequencies.frequency(dir.page[candidate]) > frequencies.frequency(dir.page[victim]))
+        {
+            evict(victim);
+            moveTo(candidate, Probation);
+        }
+        else
+        {
+            evict(candidate);
+        }
+    };
+
+    // Estado inicial: las páginas cargadas llenan la ventana y luego la región a prueba
+    for (int j = 0; j < c; ++j)
+    {
+        int page = sim.memory[j].pageNumber;
+        if (page != -1 && dir.find(page) == -1)
+        {
+            int n = dir.acquire(page);
+            dir.frame[n] = j;
+            dir.owner[n] = (lists[Window].size < windowCapacity) ? Window : Probation;
+            lists[dir.owner[n]].pushBack(n);
+        }
+    }
+
+    PackedAccess access;
+    for (size_t i = 0; accesses.next(access); ++i)
+    {
+        int page = accessPage(access);
+        bool modified = accessModified(access);
+        frequencies.record(page);
+        int n = dir.find(page);
+
+        if (n != -1)
+        {
+            touchFrame(sim, dir.frame[n], modified);
+            if (dir.owner[n] == Probation)
+            {
+                // Segundo uso en la región principal: pasa a la protegida
+                moveTo(n, Protected);
+                if (lists[Protected].size > protectedCapacity)
+                    moveTo(lists[Protected].head, Probation);
+            }
+            else
+            {
+                lists[dir.owner[n]].moveToBack(n);
+            }
+            continue;
+        }
+
+        sim.pageFaults++;
+        if (freeFrames.empty())
+            makeRoom();
+
+        n = dir.acquire(page);
+        dir.frame[n] = freeFrames.take();
+        dir.owner[n] = Window;
+        lists[Window].pushBack(n);
+        loadFrame(sim, dir.frame[n], page, modified);
+
+        // Con marcos libres la ventana puede exceder su tamaño: su LRU pasa a la principal
+        if (lists[Window].size > windowCapacity && lists[Probation].size + lists[Protected].size < mainCapacity)
+            moveTo(lists[Window].head, Probation);
+    }
+
+    sim.metadataBytes = dir.metadataBytes() + frequencies.bytes();
+}
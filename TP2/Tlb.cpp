@@ -0,0 +1,258 @@
+#include "Tlb.hpp"
+#include "Algorithms.hpp"
+#include "TraceStream.hpp"
+#include <algorithm>
+#include <cctype>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+// Bits de dirección que cubre una entrada de cada directorio: PML4 (512 GiB), PDPT (1 GiB), PD (2 MiB)
+static const int DIRECTORY_COVERAGE[] = {39, 30, 21};
+
+// Niveles de la caminata hasta la entrada hoja de una página de 2^shift bytes
+static int walkLevels(int shift)
+{
+    return shift >= 30 ? 2 : shift >= 21 ? 3 : 4;
+}
+
+bool parseTlbConfig(const std::string &text, TlbConfig &config)
+{
+    std::istringstream fields(text);
+    std::string field;
+    try
+    {
+        if (!std::getline(fields, field, ','))
+            return false;
+        config.entries = std::stoi(field);
+        config.ways = std::min(4, config.entries);
+        if (std::getline(fields, field, ',') && !field.empty())
+            config.ways = std::stoi(field);
+        if (std::getline(fields, field, ','))
+        {
+            field.erase(std::remove_if(field.begin(), field.end(), ::isspace), field.end());
+            std::transform(field.begin(), field.end(), field.begin(), ::tolower);
+            if (field == "lru")
+                config.policy = TlbPolicy::LRU;
+            else if (field == "fifo")
+                config.policy = TlbPolicy::FIFO;
+            else if (field == "random")
+                config.policy = TlbPolicy::Random;
+            else
+                return false;
+        }
+    }
+    catch (...)
+    {
+        return false;
+    }
+    return config.entries > 0 && config.ways > 0 && config.entries % config.ways == 0;
+}
+
+std::string to_string(TlbPolicy policy)
+{
+    switch (policy)
+    {
+        case TlbPolicy::LRU: return "LRU";
+        case TlbPolicy::FIFO: return "FIFO";
+        case TlbPolicy::Random: return "Random";
+    }
+    return "Desconocida";
+}
+
+bool TranslationBuffer::WalkCache::lookup(uint64_t tag, uint64_t time)
+{
+    for (size_t i = 0; i < tags.size(); ++i)
+    {
+        if (tags[i] == tag)
+        {
+            stamps[i] = time;
+            return true;
+        }
+    }
+    return false;
+}
+
+void TranslationBuffer::WalkCache::insert(uint64_t tag, uint64_t time)
+{
+    if (lookup(tag, time))
+        return;
+    if (tags.size() < static_cast<size_t>(PAGE_WALK_CACHE_ENTRIES))
+    {
+        tags.push_back(tag);
+        stamps.push_back(time);
+        return;
+    }
+    size_t victim = std::min_element(stamps.begin(), stamps.end()) - stamps.begin();
+    tags[victim] = tag;
+    stamps[victim] = time;
+}
+
+TranslationBuffer::TranslationBuffer(const TlbConfig &config, int pageShift, int basePageShift)
+    : config(config), pageShift(pageShift), baseShift(basePageShift), sets(config.entries / config.ways),
+      levels(walkLevels(pageShift)), tags(config.entries, 0), stamps(config.entries, 0),
+      walkCaches(levels - 1)
+{
+}
+
+void TranslationBuffer::access(int page)
+{
+    access(page, pageShift);
+}
+
+uint64_t TranslationBuffer::virtualPageOf(int page, int mappedShift) const
+{
+    return static_cast<uint64_t>(static_cast<uint32_t>(page)) >> (mappedShift - baseShift);
+}
+
+uint64_t TranslationBuffer::tagOf(uint64_t virtualPage, int mappedShift)
+{
+    return ((virtualPage << 6) | static_cast<uint64_t>(mappedShift)) + 1;
+}
+
+void TranslationBuffer::access(int page, int mappedShift)
+{
+    time++;
+    uint64_t basePage = static_cast<uint32_t>(page);
+    uint64_t virtualPage = virtualPageOf(page, mappedShift);
+    uint64_t tag = tagOf(virtualPage, mappedShift);
+
+    size_t first = static_cast<size_t>(virtualPage % sets) * config.ways;
+    size_t victim = first;
+    for (size_t way = first; way < first + config.ways; ++way)
+    {
+        if (tags[way] == tag)
+        {
+            if (config.policy == TlbPolicy::LRU)
+                stamps[way] = time;
+            return;
+        }
+        // Una vía vacía tiene sello 0 y queda elegida antes que cualquier ocupada
+        if (stamps[way] < stamps[victim])
+            victim = way;
+    }
+
+    misses++;
+    walk(basePage, walkLevels(mappedShift));
+
+    if (config.policy == TlbPolicy::Random && tags[victim] != 0)
+    {
+        random ^= random << 13;
+        random ^= random >> 7;
+        random ^= random << 17;
+        victim = first + random % config.ways;
+    }
+    tags[victim] = tag;
+    stamps[victim] = time;
+}
+
+void TranslationBuffer::invalidate(int page, int mappedShift)
+{
+    uint64_t virtualPage = virtualPageOf(page, mappedShift);
+    uint64_t tag = tagOf(virtualPage, mappedShift);
+    size_t first = static_cast<size_t>(virtualPage % sets) * config.ways;
+    for (size_t way = first; way < first + config.ways; ++way)
+    {
+        if (tags[way] == tag)
+        {
+            tags[way] = 0;
+            stamps[way] = 0;
+            return;
+        }
+    }
+}
+
+// Caminata desde el directorio más profundo que esté en la caché; luego se cachean todos
+void TranslationBuffer::walk(uint64_t basePage, int depth)
+{
+    uint64_t address = basePage << baseShift;
+    int refs = depth;
+    for (int level = depth - 2; level >= 0; --level)
+    {
+        if (walkCaches[level].lookup(address >> DIRECTORY_COVERAGE[level], time))
+        {
+            refs = depth - 1 - level;
+            break;
+        }
+    }
+    walkRefs += refs;
+
+    for (int level = 0; level < depth - 1; ++level)
+        walkCaches[level].insert(address >> DIRECTORY_COVERAGE[level], time);
+}
+
+TlbStats TranslationBuffer::stats() const
+{
+    TlbStats result;
+    result.pageShift = pageShift;
+    result.levels = levels;
+    result.accesses = time;
+    result.misses = misses;
+    result.walkRefs = walkRefs;
+    if (time > 0)
+        result.cyclesPerAccess = config.hitCycles + static_cast<double>(walkRefs) * config.levelCycles / time;
+    return result;
+}
+
+TranslationStage::TranslationStage(const AccessTrace &trace, std::vector<TranslationBuffer> &buffers)
+    : pos(trace.begin()), last(trace.end()), buffers(buffers)
+{
+}
+
+bool TranslationStage::nextChunk(const PackedAccess *&begin, const PackedAccess *&end)
+{
+    if (pos == last)
+        return false;
+    begin = pos;
+    end = pos + std::min<size_t>(DEFAULT_CHUNK_ACCESSES, last - pos);
+    for (auto &buffer : buffers)
+    {
+        for (const PackedAccess *access = begin; access != end; ++access)
+            buffer.access(accessPage(*access));
+    }
+    pos = end;
+    return true;
+}
+
+bool runTranslated(PageReplacementSimulator &sim, const AccessTrace &trace, std::vector<TranslationBuffer> &buffers)
+{
+    TranslationStage stage(trace, buffers);
+
+    // OPT recorre la traza completa con índices: se traduce toda antes
+    if (sim.algorithm == ReplacementAlgorithm::OPT)
+    {
+        const PackedAccess *begin, *end;
+        while (stage.nextChunk(begin, end))
+        {
+        }
+        return runAlgorithm(sim, trace);
+    }
+
+    AccessCursor accesses(stage);
+    return runAlgorithm(sim, accesses);
+}
+
+std::string pageSizeLabel(int shift)
+{
+    static const char *units[] = {"B", "KiB", "MiB", "GiB", "TiB"};
+    return std::to_string(1ULL << (shift % 10)) + " " + units[shift / 10];
+}
+
+void printTlb(const std::vector<TlbStats> &stats, const TlbConfig &config)
+{
+    std::cout << "\n=== TLB (" << config.entries << " entradas, " << config.ways << " vías, "
+              << to_string(config.policy) << "; acierto " << config.hitCycles << " ciclos, "
+              << config.levelCycles << " ciclos por nivel) ===\n";
+    std::cout << std::setw(10) << "Página" << std::setw(9) << "Niveles" << std::setw(12) << "Fallos TLB"
+              << std::setw(16) << "Tasa de fallos" << std::setw(18) << "Refs/caminata" << std::setw(16)
+              << "Ciclos/acceso" << "\n";
+    for (const auto &row : stats)
+    {
+        double missRate = row.accesses ? static_cast<double>(row.misses) / row.accesses : 0.0;
+        double refsPerWalk = row.misses ? static_cast<double>(row.walkRefs) / row.misses : 0.0;
+        std::cout << std::setw(10) << pageSizeLabel(row.pageShift) << std::setw(9) << row.levels << std::setw(12)
+                  << row.misses << std::fixed << std::setprecision(4) << std::setw(16) << missRate
+                  << std::setprecision(2) << std::setw(18) << refsPerWalk << std::setw(16) << row.cyclesPerAccess
+                  << std::defaultfloat << "\n";
+    }
+}
@@ -0,0 +1,139 @@
+#ifndef TLB_HPP
+#define TLB_HPP
+
+#include "PageReplacement.hpp"
+#include "AccessTrace.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Costos de traducción por defecto (ciclos): acierto en el TLB y cada referencia a memoria
+// de la caminata por la tabla de páginas
+const int DEFAULT_TLB_HIT_CYCLES = 1;
+const int DEFAULT_WALK_LEVEL_CYCLES = 30;
+
+// Entradas por nivel de las cachés de la caminata (entradas PML4, PDPT y PD ya leídas)
+const int PAGE_WALK_CACHE_ENTRIES = 32;
+
+// Política de reemplazo dentro de cada conjunto del TLB
+enum class TlbPolicy
+{
+    LRU,
+    FIFO,
+    Random
+};
+
+// Geometría y costos del TLB
+struct TlbConfig
+{
+    int entries = 64;
+    int ways = 4;
+    TlbPolicy policy = TlbPolicy::LRU;
+    int hitCycles = DEFAULT_TLB_HIT_CYCLES;
+    int levelCycles = DEFAULT_WALK_LEVEL_CYCLES;
+};
+
+// Parsea "entradas,vías,política" (ej. "64,4,LRU"); false si es inválido
+bool parseTlbConfig(const std::string &text, TlbConfig &config);
+
+std::string to_string(TlbPolicy policy);
+
+// Resultado de la traducción de una traza con un tamaño de página
+struct TlbStats
+{
+    int pageShift = 0;    // Log2 del tamaño de página que mapea cada entrada
+    int levels = 0;       // Niveles de la tabla de páginas hasta la entrada hoja
+    size_t accesses = 0;
+    size_t misses = 0;
+    size_t walkRefs = 0;  // Referencias a memoria de todas las caminatas
+    double cyclesPerAccess = 0.0;
+};
+
+/**
+ * @brief TLB asociativo por conjuntos con caminata de 4 niveles (x86-64) en los fallos.
+ *
+ * Cada entrada mapea una página de 2^pageShift bytes: 4 KiB (entrada hoja en el nivel PT,
+ * 4 niveles), 2 MiB (PD, 3 niveles) o 1 GiB (PDPT, 2 niveles). En un fallo del TLB la
+ * caminata arranca en el nivel más profundo cuya entrada está en la caché de la caminata
+ * (como las paging-structure caches de x86) y cada nivel restante es una referencia a
+ * memoria de `levelCycles` ciclos.
+ */
+class TranslationBuffer
+{
+public:
+    TranslationBuffer(const TlbConfig &config, int pageShift, int basePageShift);
+
+    // Traduce un acceso a la página `page` (en páginas base de 2^basePageShift bytes)
+    void access(int page);
+
+    // Igual, con la página mapeada por una entrada de 2^mappedShift bytes (>= pageShift):
+    // con tamaños mixtos las entradas de cada tamaño comparten el TLB y sus conjuntos
+    void access(int page, int mappedShift);
+
+    // Invalida la entrada que mapea `page` con una página de 2^mappedShift bytes, si está
+    // (como invlpg al desalojar la página o cambiar su tamaño)
+    void invalidate(int page, int mappedShift);
+
+    TlbStats stats() const;
+
+private:
+    // Caché totalmente asociativa LRU de entradas de un nivel de la tabla de páginas
+    struct WalkCache
+    {
+        std::vector<uint64_t> tags;
+        std::vector<uint64_t> stamps;
+
+        bool lookup(uint64_t tag, uint64_t time);
+        void insert(uint64_t tag, uint64_t time);
+    };
+
+    void walk(uint64_t basePage, int depth);
+
+    // Página virtual y tag de `page` mapeada con una página de 2^mappedShift bytes
+    uint64_t virtualPageOf(int page, int mappedShift) const;
+    static uint64_t tagOf(uint64_t virtualPage, int mappedShift);
+
+    TlbConfig config;
+    int pageShift;
+    int baseShift;
+    int sets;
+    int levels;                   // Niveles de las entradas de 2^pageShift bytes (los más)
+    std::vector<uint64_t> tags;   // sets × ways, tag = (página virtual, tamaño) + 1 (0 = vacía)
+    std::vector<uint64_t> stamps; // Último uso (LRU) o momento de carga (FIFO)
+    std::vector<WalkCache> walkCaches; // Un nivel por cada directorio por encima de la hoja
+    uint64_t time = 0;
+    uint64_t random = 0x2545f4914f6cdd1dULL;
+    size_t misses = 0;
+    size_t walkRefs = 0;
+};
+
+/**
+ * @brief Etapa de traducción delante de un algoritmo de reemplazo.
+ *
+ * Entrega la traza al algoritmo en bloques (como ChunkSource) y, antes de cada bloque, lo
+ * traduce en cada TLB. Así la traza se recorre una vez para el reemplazo y la traducción.
+ */
+class TranslationStage : public ChunkSource
+{
+public:
+    TranslationStage(const AccessTrace &trace, std::vector<TranslationBuffer> &buffers);
+
+    bool nextChunk(const PackedAccess *&begin, const PackedAccess *&end) override;
+
+private:
+    const PackedAccess *pos;
+    const PackedAccess *last;
+    std::vector<TranslationBuffer> &buffers;
+};
+
+// Ejecuta el algoritmo de `sim` con la etapa de traducción delante (OPT, que necesita la
+// traza completa, la recorre después de traducirla); false si no es un algoritmo de reemplazo
+bool runTranslated(PageReplacementSimulator &sim, const AccessTrace &trace, std::vector<TranslationBuffer> &buffers);
+
+// Tamaño de página legible: "4 KiB", "2 MiB", "1 GiB"
+std::string pageSizeLabel(int shift);
+
+// Imprime una fila por tamaño de página: fallos del TLB y ciclos de traducción por acceso
+void printTlb(const std::vector<TlbStats> &stats, const TlbConfig &config);
+
+#endif // TLB_HPP
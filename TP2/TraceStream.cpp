@@ -0,0 +1,199 @@
+#include "TraceStream.hpp"
+#include "Algorithms.hpp"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+TraceReader::TraceReader(const std::string &path, int pageShift) : block(TEXT_BLOCK_BYTES)
+{
+    if (path == "-")
+    {
+        file = stdin;
+    }
+    else
+    {
+        file = std::fopen(path.c_str(), "rb");
+        ownsFile = true;
+    }
+    if (!file)
+        return;
+
+    // Si empieza con la cabecera binaria, el resto son palabras empaquetadas; si no, es texto
+    TraceFileHeader header;
+    size_t got = std::fread(&header, 1, sizeof(header), file);
+    if (got == sizeof(header) && std::memcmp(header.magic, TRACE_FILE_MAGIC, sizeof(header.magic)) == 0 &&
+        header.version == TRACE_FILE_VERSION)
+    {
+        binary = true;
+        remaining = header.count;
+    }
+    else
+    {
+        // El primer bloque de texto decide si son páginas o direcciones
+        pendingText.assign(reinterpret_cast<const char *>(&header), got);
+        if (got == sizeof(header))
+            pendingText.append(block.data(), std::fread(block.data(), 1, block.size() - got, file));
+        tokenizer = makeTextTokenizer(pendingText.data(), pendingText.size(), pageShift);
+    }
+}
+
+TraceReader::~TraceReader()
+{
+    if (file && ownsFile)
+        std::fclose(file);
+}
+
+bool TraceReader::read(AccessTrace &chunk, size_t capacity)
+{
+    chunk.clear();
+    if (finished || !file)
+        return false;
+
+    if (binary)
+    {
+        size_t want = static_cast<size_t>(std::min<uint64_t>(capacity, remaining));
+        words.resize(want);
+        size_t got = std::fread(words.data(), sizeof(PackedAccess), want, file);
+        chunk.append(words.data(), got);
+        remaining -= got;
+        if (got < want || remaining == 0)
+            finished = true; // Fin de la traza (o archivo truncado)
+        return got > 0;
+    }
+
+    if (!pendingText.empty())
+    {
+        tokenizer->feed(pendingText.data(), pendingText.size(), chunk);
+        pendingText.clear();
+    }
+
+    // Un bloque de texto puede agregar varios accesos: el bloque de accesos se pasa de
+    // `capacity` a lo sumo en lo que rinde un bloque de texto
+    while (chunk.size() < capacity)
+    {
+        size_t got = std::fread(block.data(), 1, block.size(), file);
+        if (got == 0)
+        {
+            tokenizer->finish(chunk);
+            finished = true;
+            break;
+        }
+        tokenizer->feed(block.data(), got, chunk);
+    }
+    return !chunk.empty();
+}
+
+ChunkBroadcast::ChunkBroadcast(size_t slots, size_t consumers)
+    : chunks(std::max<size_t>(1, slots)), pending(chunks.size(), 0), nextSeq(consumers, 0),
+      holding(consumers, false)
+{
+}
+
+AccessTrace &ChunkBroadcast::acquire()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    size_t slot = published % chunks.size();
+    released.wait(lock, [&] { return pending[slot] == 0; });
+    return chunks[slot];
+}
+
+void ChunkBroadcast::publish()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    pending[published % chunks.size()] = nextSeq.size();
+    published++;
+    produced.notify_all();
+}
+
+void ChunkBroadcast::close()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    closed = true;
+    produced.notify_all();
+}
+
+const AccessTrace *ChunkBroadcast::take(size_t consumer)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    if (holding[consumer])
+    {
+        size_t slot = (nextSeq[consumer] - 1) % chunks.size();
+        if (--pending[slot] == 0)
+            released.notify_all();
+        holding[consumer] = false;
+    }
+
+    produced.wait(lock, [&] { return published > nextSeq[consumer] || closed; });
+    if (published <= nextSeq[consumer])
+        return nullptr;
+
+    const AccessTrace *chunk = &chunks[nextSeq[consumer] % chunks.size()];
+    nextSeq[consumer]++;
+    holding[consumer] = true;
+    return chunk;
+}
+
+// Vista de un consumidor sobre la difusión, para recorrerla con un AccessCursor
+class BroadcastSource : public ChunkSource
+{
+public:
+    BroadcastSource(ChunkBroadcast &broadcast, size_t consumer) : broadcast(broadcast), consumer(consumer) {}
+
+    bool nextChunk(const PackedAccess *&begin, const PackedAccess *&end) override
+    {
+        const AccessTrace *chunk = broadcast.take(consumer);
+        if (!chunk)
+            return false;
+        begin = chunk->begin();
+        end = chunk->end();
+        return true;
+    }
+
+private:
+    ChunkBroadcast &broadcast;
+    size_t consumer;
+};
+
+size_t runStreaming(const std::string &path, std::vector<PageReplacementSimulator> &sims, int pageShift,
+                    size_t chunkSize, size_t slots)
+{
+    TraceReader reader(path, pageShift);
+    if (!reader.isOpen())
+    {
+        std::cerr << "Error: no se pudo abrir el archivo de traza: " << path << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+
+    ChunkBroadcast broadcast(slots, sims.size());
+    std::vector<std::thread> workers;
+    for (size_t c = 0; c < sims.size(); ++c)
+    {
+        workers.emplace_back([&, c]() {
+            BroadcastSource source(broadcast, c);
+            AccessCursor accesses(source);
+            runAlgorithm(sims[c], accesses);
+
+            // Un algoritmo que no consume la traza no debe frenar al productor
+            PackedAccess access;
+            while (accesses.next(access))
+            {
+            }
+        });
+    }
+
+    size_t total = 0;
+    while (true)
+    {
+        AccessTrace &chunk = broadcast.acquire();
+        if (!reader.read(chunk, chunkSize))
+            break;
+        total += chunk.size();
+        broadcast.publish();
+    }
+    broadcast.close();
+
+    for (auto &worker : workers)
+        worker.join();
+    return total;
+}
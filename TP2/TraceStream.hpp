@@ -0,0 +1,102 @@
+#ifndef TRACE_STREAM_HPP
+#define TRACE_STREAM_HPP
+
+#include "PageReplacement.hpp"
+#include "AccessTrace.hpp"
+#include <condition_variable>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Accesos por bloque y bloques en circulación del procesamiento en streaming
+const size_t DEFAULT_CHUNK_ACCESSES = 64 * 1024;
+const size_t DEFAULT_CHUNK_SLOTS = 4;
+
+/**
+ * @brief Lee una traza por bloques desde un archivo o desde la entrada estándar ("-").
+ *
+ * Reconoce el formato binario (cabecera TP2T) y, si no, parsea el texto de a
+ * TEXT_BLOCK_BYTES, ya sea de páginas o de direcciones virtuales (páginas de
+ * 2^pageShift bytes). Nunca tiene en memoria más que un bloque de texto y el bloque de
+ * accesos que se está llenando.
+ */
+class TraceReader
+{
+public:
+    TraceReader(const std::string &path, int pageShift);
+    ~TraceReader();
+
+    TraceReader(const TraceReader &) = delete;
+    TraceReader &operator=(const TraceReader &) = delete;
+
+    bool isOpen() const { return file != nullptr; }
+
+    // Reemplaza el contenido de `chunk` con los próximos ~`capacity` accesos; false al terminar
+    bool read(AccessTrace &chunk, size_t capacity);
+
+private:
+    FILE *file = nullptr;
+    bool ownsFile = false;
+    bool binary = false;
+    uint64_t remaining = 0; // Accesos binarios que faltan leer
+    bool finished = false;
+    std::unique_ptr<TextTokenizer> tokenizer;
+    std::vector<char> block;
+    std::string pendingText; // Primer bloque, leído para reconocer el formato, si es de texto
+    std::vector<PackedAccess> words;
+};
+
+/**
+ * @brief Difusión de bloques de un productor a varios consumidores con memoria acotada.
+ *
+ * Hay `slots` bloques reutilizables en un anillo. El productor llena el siguiente bloque
+ * cuando todos los consumidores terminaron con su uso anterior, y cada consumidor recorre
+ * los bloques en orden a su propio ritmo. Así la memoria es slots × tamaño de bloque sin
+ * importar el largo de la traza, y el consumidor más lento frena al productor.
+ */
+class ChunkBroadcast
+{
+public:
+    ChunkBroadcast(size_t slots, size_t consumers);
+
+    // Productor: bloque a llenar (espera a que quede libre), luego publish()
+    AccessTrace &acquire();
+    void publish();
+    void close(); // No habrá más bloques
+
+    // Consumidor: libera su bloque anterior y devuelve el siguiente (nullptr al terminar)
+    const AccessTrace *take(size_t consumer);
+
+private:
+    std::mutex mutex;
+    std::condition_variable produced; // Hay un bloque nuevo o se cerró la difusión
+    std::condition_variable released; // Algún consumidor liberó un bloque
+
+    std::vector<AccessTrace> chunks;
+    std::vector<size_t> pending;  // Consumidores que todavía no terminaron cada bloque
+    std::vector<size_t> nextSeq;  // Próximo bloque (secuencia) de cada consumidor
+    std::vector<bool> holding;    // ¿El consumidor tiene un bloque sin liberar?
+    size_t published = 0;         // Bloques publicados
+    bool closed = false;
+};
+
+/**
+ * @brief Ejecuta varios simuladores a la vez sobre una traza leída en bloques.
+ *
+ * El hilo que llama lee la traza y cada simulador corre en su propio hilo con un
+ * AccessCursor sobre los bloques difundidos. La traza se recorre una sola vez y nunca
+ * está completa en memoria. OPT no puede ejecutarse así porque necesita el futuro.
+ *
+ * @param path       Archivo de traza (texto o binario) o "-" para la entrada estándar.
+ * @param sims       Simuladores ya configurados (algoritmo, marcos, estado inicial).
+ * @param pageShift  Log2 del tamaño de página, si la traza es de direcciones.
+ * @param chunkSize  Accesos por bloque.
+ * @param slots      Bloques en circulación.
+ * @return Cantidad de accesos procesados.
+ */
+size_t runStreaming(const std::string &path, std::vector<PageReplacementSimulator> &sims,
+                    int pageShift = DEFAULT_PAGE_SHIFT, size_t chunkSize = DEFAULT_CHUNK_ACCESSES, size_t slots = DEFAULT_CHUNK_SLOTS);
+
+#endif // TRACE_STREAM_HPP
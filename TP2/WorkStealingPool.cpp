@@ -0,0 +1,58 @@
+#include "WorkStealingPool.hpp"
+#include <algorithm>
+#include <thread>
+
+WorkStealingPool::WorkStealingPool(unsigned threads)
+    : threads(threads ? threads : std::max(1u, std::thread::hardware_concurrency())),
+      queues(this->threads)
+{
+}
+
+bool WorkStealingPool::popLocal(WorkQueue &queue, std::function<void()> &task)
+{
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty())
+        return false;
+    task = std::move(queue.tasks.back());
+    queue.tasks.pop_back();
+    return true;
+}
+
+bool WorkStealingPool::steal(unsigned thief, std::function<void()> &task)
+{
+    // Se recorren las demás colas empezando por la vecina para repartir los robos
+    for (unsigned k = 1; k < threads; ++k)
+    {
+        WorkQueue &victim = queues[(thief + k) % threads];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty())
+        {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+void WorkStealingPool::work(unsigned id)
+{
+    std::function<void()> task;
+    // Sin tareas nuevas durante el lote: si no hay nada propio ni para robar, se terminó
+    while (popLocal(queues[id], task) || steal(id, task))
+        task();
+}
+
+void WorkStealingPool::run(std::vector<std::function<void()>> tasks)
+{
+    for (size_t i = 0; i < tasks.size(); ++i)
+        queues[i % threads].tasks.push_back(std::move(tasks[i]));
+
+    std::vector<std::thread> workers;
+    for (unsigned id = 1; id < threads; ++id)
+        workers.emplace_back(&WorkStealingPool::work, this, id);
+    work(0); // El hilo que llama también trabaja
+
+    for (auto &worker : workers)
+        worker.join();
+}
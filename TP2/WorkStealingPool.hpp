@@ -0,0 +1,43 @@
+#ifndef WORK_STEALING_POOL_HPP
+#define WORK_STEALING_POOL_HPP
+
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+/**
+ * @brief Conjunto de hilos con robo de trabajo para un lote fijo de tareas.
+ *
+ * Las tareas se reparten en una cola por hilo. Cada hilo toma las suyas del final de su
+ * cola y, cuando se le acaban, roba del inicio de la cola de otro hilo, de modo que las
+ * tareas largas (muchos marcos, algoritmos O(marcos) por acceso) no dejan hilos ociosos.
+ * El lote termina cuando todas las colas quedan vacías.
+ */
+class WorkStealingPool
+{
+public:
+    // 0 hilos usa la cantidad de núcleos disponibles
+    explicit WorkStealingPool(unsigned threads = 0);
+
+    unsigned threadCount() const { return threads; }
+
+    // Ejecuta todas las tareas y vuelve cuando terminaron
+    void run(std::vector<std::function<void()>> tasks);
+
+private:
+    struct WorkQueue
+    {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    bool popLocal(WorkQueue &queue, std::function<void()> &task);
+    bool steal(unsigned thief, std::function<void()> &task);
+    void work(unsigned id);
+
+    unsigned threads;
+    std::vector<WorkQueue> queues;
+};
+
+#endif // WORK_STEALING_POOL_HPP
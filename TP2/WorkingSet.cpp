@@ -0,0 +1,77 @@
+#include "WorkingSet.hpp"
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+
+WorkingSetAnalyzer::WorkingSetAnalyzer(int window)
+    : window(std::max(1, window)), recent(std::max(1, window), -1)
+{
+    lastUse.reserve(this->window);
+}
+
+int WorkingSetAnalyzer::access(int page)
+{
+    size_t slot = time % window;
+
+    // El acceso de hace τ pasos sale de la ventana
+    if (time >= static_cast<size_t>(window))
+    {
+        auto it = lastUse.find(recent[slot]);
+        if (it->second == time - window)
+        {
+            lastUse.erase(it);
+            current--;
+        }
+    }
+
+    auto [it, inserted] = lastUse.try_emplace(page, time);
+    if (inserted)
+        current++;
+    else
+        it->second = time;
+
+    recent[slot] = page;
+    time++;
+    return current;
+}
+
+WorkingSetSeries computeWorkingSet(const AccessTrace &trace, int window)
+{
+    WorkingSetSeries series;
+    series.window = std::max(1, window);
+
+    WorkingSetAnalyzer analyzer(series.window);
+    long long total = 0;
+
+    for (size_t i = 0; i < trace.size(); ++i)
+    {
+        int size = analyzer.access(trace.page(i));
+        total += size;
+
+        if (series.points.empty() || series.points.back().size != size)
+            series.points.push_back({i, size});
+        if (size > series.peak)
+        {
+            series.peak = size;
+            series.peakTime = i;
+        }
+    }
+
+    if (!trace.empty())
+        series.average = static_cast<double>(total) / trace.size();
+    return series;
+}
+
+void printWorkingSet(const WorkingSetSeries &series, size_t accessCount)
+{
+    std::cout << "\n=== Conjunto de trabajo W(t, τ) con τ = " << series.window << " accesos ===\n";
+    std::cout << std::setw(10) << "Acceso" << std::setw(10) << "|W|" << "\n";
+
+    for (const auto &point : series.points)
+        std::cout << std::setw(10) << point.time << std::setw(10) << point.size << "\n";
+
+    std::cout << "\nAccesos: " << accessCount << "\n";
+    std::cout << "Conjunto de trabajo promedio: " << std::fixed << std::setprecision(2) << series.average << " páginas\n";
+    std::cout << "Conjunto de trabajo máximo: " << series.peak << " páginas (acceso " << series.peakTime << ")\n";
+    std::cout << "Marcos sugeridos: " << series.peak << "\n";
+}
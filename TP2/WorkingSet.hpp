@@ -0,0 +1,58 @@
+#ifndef WORKING_SET_HPP
+#define WORKING_SET_HPP
+
+#include "AccessTrace.hpp"
+#include <unordered_map>
+#include <vector>
+#include <cstddef>
+
+// Cambio en el tamaño del conjunto de trabajo: desde el acceso `time` vale `size`
+struct WorkingSetPoint
+{
+    size_t time = 0;
+    int size = 0;
+};
+
+// Serie temporal del conjunto de trabajo W(t, τ) y su resumen
+struct WorkingSetSeries
+{
+    int window = 0;                      // Ventana τ en accesos
+    std::vector<WorkingSetPoint> points; // Solo los instantes en que cambia |W|
+    int peak = 0;                        // Máximo de |W(t, τ)|
+    size_t peakTime = 0;                 // Primer acceso en que se alcanza el máximo
+    double average = 0.0;                // Promedio de |W(t, τ)| sobre todos los accesos
+};
+
+/**
+ * @brief Tamaño del conjunto de trabajo en una sola pasada, en O(1) por acceso.
+ *
+ * W(t, τ) son las páginas distintas referenciadas en los últimos τ accesos. Se guardan
+ * las últimas τ páginas en un buffer circular y el último acceso de cada página dentro de
+ * la ventana: cuando un acceso sale de la ventana, su página deja el conjunto solo si no
+ * volvió a usarse después. La memoria es O(τ), independiente del largo de la traza.
+ */
+class WorkingSetAnalyzer
+{
+public:
+    explicit WorkingSetAnalyzer(int window);
+
+    // Registra el acceso a `page` y devuelve |W(t, τ)| incluyéndolo
+    int access(int page);
+
+    int size() const { return current; }
+
+private:
+    int window;
+    std::vector<int> recent;                  // Últimas τ páginas (buffer circular)
+    std::unordered_map<int, size_t> lastUse; // Página → último acceso dentro de la ventana
+    size_t time = 0;
+    int current = 0;
+};
+
+// Calcula la serie W(t, τ) para toda la traza
+WorkingSetSeries computeWorkingSet(const AccessTrace &trace, int window);
+
+// Imprime la serie (solo los cambios de tamaño) y el conjunto de trabajo máximo
+void printWorkingSet(const WorkingSetSeries &series, size_t accessCount);
+
+#endif // WORKING_SET_HPP
@@ -1,9 +1,91 @@
 #include "PageReplacement.hpp"
 #include "Algorithms.hpp"
+#include "MissRatioCurve.hpp"
+#include "WorkingSet.hpp"
+#include "Sweep.hpp"
+#include "TraceStream.hpp"
+#include "AddressTrace.hpp"
+#include "Shards.hpp"
+#include "MultiProcess.hpp"
+#include "Tlb.hpp"
+#include "HugePages.hpp"
+#include "Prefetch.hpp"
+#include "Tiers.hpp"
+#include "Timeline.hpp"
+#include "Checkpoint.hpp"
 #include <iostream>
 #include <vector>
 #include <string>
 #include <algorithm>
+#include <memory>
+#include <sstream>
+
+// Resultado de un algoritmo en el modo ranking
+struct ResultadoRanking
+{
+    std::string nombre;
+    int64_t fallos;
+    double bytesPorMarco; // Metadatos de reemplazo por marco (0 si el algoritmo no los informa)
+    int64_t desalojosLimpios;
+    int64_t desalojosSucios;
+    double eat;           // Tiempo efectivo de acceso (µs)
+    long long bytesES;    // Volumen de E/S con el disco
+};
+
+// Imprime desalojos, tiempo efectivo de acceso y volumen de E/S de una simulación
+static void printCost(int64_t limpios, int64_t sucios, double eat, long long bytesES, const char *prefijo)
+{
+    std::cout << prefijo << "Desalojos: " << limpios << " limpios, " << sucios << " sucios"
+              << " | EAT: " << eat << " µs | E/S: " << bytesES / 1024 << " KiB\n";
+}
+
+// Resultado de un simulador ya ejecutado sobre `accesos` accesos
+static ResultadoRanking resultadoDe(const PageReplacementSimulator &sim, size_t accesos)
+{
+    return {to_string(sim.algorithm), sim.pageFaults, static_cast<double>(sim.metadataBytes) / sim.frameCount,
+            sim.cleanEvictions, sim.dirtyEvictions, effectiveAccessTime(sim, accesos), ioVolumeBytes(sim)};
+}
+
+// Ordena por fallos (a igual cantidad, por EAT) e imprime el ranking
+static void imprimirRanking(std::vector<ResultadoRanking> resultados)
+{
+    std::stable_sort(resultados.begin(), resultados.end(), [](auto &a, auto &b) {
+        return a.fallos != b.fallos ? a.fallos < b.fallos : a.eat < b.eat;
+    });
+
+    std::cout << "\n=== Ranking de algoritmos (menor a mayor cantidad de fallos) ===\n";
+    for (size_t i = 0; i < resultados.size(); ++i) {
+        std::cout << i + 1 << ". " << resultados[i].nombre << ": " << resultados[i].fallos << " fallos";
+        if (resultados[i].bytesPorMarco > 0)
+            std::cout << " (metadatos: " << resultados[i].bytesPorMarco << " bytes/marco)";
+        std::cout << "\n";
+        printCost(resultados[i].desalojosLimpios, resultados[i].desalojosSucios, resultados[i].eat,
+                  resultados[i].bytesES, "   ");
+    }
+}
+
+// Parsea una lista como "LRU, ARC, OPT"; false (con mensaje) si algún nombre no es un
+// algoritmo de reemplazo
+static bool leerAlgoritmos(const std::string &entrada, std::vector<ReplacementAlgorithm> &algoritmos)
+{
+    algoritmos.clear();
+    std::istringstream lista(entrada);
+    std::string nombre;
+    while (std::getline(lista, nombre, ','))
+    {
+        nombre.erase(0, nombre.find_first_not_of(" \t"));
+        nombre.erase(nombre.find_last_not_of(" \t") + 1);
+        ReplacementAlgorithm alg = parseAlgorithm(nombre);
+        if (std::find(std::begin(REPLACEMENT_ALGORITHMS), std::end(REPLACEMENT_ALGORITHMS), alg) ==
+            std::end(REPLACEMENT_ALGORITHMS))
+        {
+            std::cerr << "Error: " << nombre << " no es un algoritmo de reemplazo.\n";
+            return false;
+        }
+        algoritmos.push_back(alg);
+    }
+    return true;
+}
 
 /**
  * @brief Programa principal que ejecuta la simulación de reemplazo de páginas.
@@ -40,113 +122,464 @@ int main()
     if (!input.empty())
         accesoStr = input;
 
+    // Las trazas de direcciones en archivo se convierten a páginas de este tamaño
+    int desplazamientoPagina = DEFAULT_PAGE_SHIFT;
+    if (!accesoStr.empty() && accesoStr[0] == '@')
+    {
+        std::cout << "Tamaño de página para trazas de direcciones: 4K, 2M o 1G (default 4K): ";
+        std::getline(std::cin, input);
+        if (!input.empty())
+            desplazamientoPagina = parsePageSize(input);
+        if (desplazamientoPagina < 0)
+        {
+            std::cerr << "Error: tamaño de página inválido: " << input << std::endl;
+            return 1;
+        }
+    }
+
+    // El temporizador simulado solo afecta a los algoritmos que reinician el bit R
+    ReplacementAlgorithm algoritmo = parseAlgorithm(algoritmoStr);
+    int intervalo = DEFAULT_TIMER_INTERVAL;
+    if (algoritmo == ReplacementAlgorithm::NRU || algoritmo == ReplacementAlgorithm::Aging ||
+        algoritmo == ReplacementAlgorithm::All || algoritmo == ReplacementAlgorithm::Sweep ||
+        algoritmo == ReplacementAlgorithm::Stream || algoritmo == ReplacementAlgorithm::Shards ||
+        algoritmo == ReplacementAlgorithm::Prefetch || algoritmo == ReplacementAlgorithm::Tiered)
+    {
+        std::cout << "Intervalo del temporizador en accesos (default " << DEFAULT_TIMER_INTERVAL << "): ";
+        std::getline(std::cin, input);
+        if (!input.empty())
+            intervalo = std::stoi(input);
+    }
+
+    int bitsAging = DEFAULT_AGING_BITS;
+    if (algoritmo == ReplacementAlgorithm::Aging)
+    {
+        std::cout << "Bits del contador de Aging: 8, 16 o 32 (default " << DEFAULT_AGING_BITS << "): ";
+        std::getline(std::cin, input);
+        if (!input.empty())
+            bitsAging = std::stoi(input);
+    }
+
+    // La ventana τ solo la usan WSClock y el análisis del conjunto de trabajo
+    int ventana = DEFAULT_WORKING_SET_WINDOW;
+    if (algoritmo == ReplacementAlgorithm::WSClock || algoritmo == ReplacementAlgorithm::WorkingSet ||
+        algoritmo == ReplacementAlgorithm::All || algoritmo == ReplacementAlgorithm::Sweep ||
+        algoritmo == ReplacementAlgorithm::Stream || algoritmo == ReplacementAlgorithm::Shards ||
+        algoritmo == ReplacementAlgorithm::Prefetch || algoritmo == ReplacementAlgorithm::Tiered)
+    {
+        std::cout << "Ventana τ del conjunto de trabajo en accesos (default " << DEFAULT_WORKING_SET_WINDOW << "): ";
+        std::getline(std::cin, input);
+        if (!input.empty())
+            ventana = std::stoi(input);
+    }
+
+    // Latencias del modelo de costo (no aplican a los modos MRC, WS, Sweep, SHARDS, Multi, THP
+    // ni Prefetch, que solo cuentan fallos)
+    double latenciaLectura = DEFAULT_READ_FAULT_US;
+    double latenciaEscritura = DEFAULT_WRITEBACK_US;
+    if (algoritmo != ReplacementAlgorithm::MRC && algoritmo != ReplacementAlgorithm::WorkingSet &&
+        algoritmo != ReplacementAlgorithm::Sweep && algoritmo != ReplacementAlgorithm::Shards &&
+        algoritmo != ReplacementAlgorithm::MultiProcess && algoritmo != ReplacementAlgorithm::HugePages &&
+        algoritmo != ReplacementAlgorithm::Prefetch)
+    {
+        std::cout << "Latencias en µs de lectura por fallo y de escritura de página sucia (default "
+                  << DEFAULT_READ_FAULT_US << "," << DEFAULT_WRITEBACK_US << "): ";
+        std::getline(std::cin, input);
+        if (!input.empty())
+        {
+            std::istringstream latencias(input);
+            std::string valor;
+            if (std::getline(latencias, valor, ',') && !valor.empty())
+                latenciaLectura = std::stod(valor);
+            if (std::getline(latencias, valor) && !valor.empty())
+                latenciaEscritura = std::stod(valor);
+        }
+    }
+
+    // Ventana en que se mide la tasa de fallos de cada proceso (PFF y thrashing)
+    int ventanaFallos = DEFAULT_FAULT_RATE_WINDOW;
+    if (algoritmo == ReplacementAlgorithm::MultiProcess)
+    {
+        std::cout << "Ventana de tasa de fallos en accesos (default " << DEFAULT_FAULT_RATE_WINDOW << "): ";
+        std::getline(std::cin, input);
+        if (!input.empty())
+            ventanaFallos = std::stoi(input);
+    }
+
+    // TLB delante de un algoritmo de reemplazo (opcional) o de las páginas grandes (siempre):
+    // geometría, política y costos de traducción
+    bool usarTlb = false;
+    TlbConfig tlb;
+    bool esReemplazo = std::find(std::begin(REPLACEMENT_ALGORITHMS), std::end(REPLACEMENT_ALGORITHMS), algoritmo) !=
+                       std::end(REPLACEMENT_ALGORITHMS);
+    if (esReemplazo || algoritmo == ReplacementAlgorithm::HugePages)
+    {
+        std::cout << "TLB entradas,vías,política LRU/FIFO/Random (default "
+                  << (esReemplazo ? "sin TLB, ejemplo 64,4,LRU" : "64,4,LRU") << "): ";
+        std::getline(std::cin, input);
+        if (!input.empty() && !parseTlbConfig(input, tlb))
+        {
+            std::cerr << "Error: configuración de TLB inválida: " << input << std::endl;
+            return 1;
+        }
+        usarTlb = !input.empty() || !esReemplazo;
+        if (usarTlb)
+        {
+            std::cout << "Ciclos por acierto del TLB y por nivel de la tabla de páginas (default "
+                      << DEFAULT_TLB_HIT_CYCLES << "," << DEFAULT_WALK_LEVEL_CYCLES << "): ";
+            std::getline(std::cin, input);
+            if (!input.empty())
+            {
+                std::istringstream ciclos(input);
+                std::string valor;
+                if (std::getline(ciclos, valor, ',') && !valor.empty())
+                    tlb.hitCycles = std::stoi(valor);
+                if (std::getline(ciclos, valor) && !valor.empty())
+                    tlb.levelCycles = std::stoi(valor);
+            }
+        }
+    }
+
+    // Serie temporal de un algoritmo (sin TLB ni OPT, que recorre la traza completa): fallos,
+    // aciertos y desalojos por ventana de accesos, en pantalla o exportados a CSV/JSON
+    int ventanaSerie = 0;
+    std::string archivoSerie;
+    if (esReemplazo && !usarTlb && algoritmo != ReplacementAlgorithm::OPT)
+    {
+        std::cout << "Ventana de la serie temporal en accesos (default sin serie, ejemplo "
+                  << DEFAULT_TIMELINE_WINDOW << "): ";
+        std::getline(std::cin, input);
+        if (!input.empty())
+        {
+            ventanaSerie = std::stoi(input);
+            if (ventanaSerie < 1)
+            {
+                std::cerr << "Error: la ventana de la serie debe ser positiva: " << input << std::endl;
+                return 1;
+            }
+            std::cout << "Archivo de la serie, .csv o .json (default mostrar cada ventana): ";
+            std::getline(std::cin, archivoSerie);
+        }
+    }
+
+    // Checkpoint: continuar la simulación de una traza a la que se agregaron accesos, y
+    // guardar el estado al terminar (solo algoritmos cuyo estado entra completo en él)
+    std::string checkpointEntrada, checkpointSalida;
+    if (esReemplazo && !usarTlb && supportsCheckpoint(algoritmo))
+    {
+        std::cout << "Checkpoint del cual continuar (default empezar de cero): ";
+        std::getline(std::cin, checkpointEntrada);
+        std::cout << "Archivo donde guardar el checkpoint al terminar (default no guardar): ";
+        std::getline(std::cin, checkpointSalida);
+    }
+
+    // Páginas grandes: tamaño y densidad con que la política por densidad promueve una región
+    int desplazamientoGrande = DEFAULT_HUGE_PAGE_SHIFT;
+    double densidad = DEFAULT_PROMOTION_DENSITY;
+    if (algoritmo == ReplacementAlgorithm::HugePages)
+    {
+        std::cout << "Tamaño de página grande (default 2M): ";
+        std::getline(std::cin, input);
+        if (!input.empty())
+            desplazamientoGrande = parsePageSize(input);
+        if (desplazamientoGrande <= desplazamientoPagina || desplazamientoGrande - desplazamientoPagina > 30)
+        {
+            std::cerr << "Error: la página grande debe ser mayor que la página base: " << input << std::endl;
+            return 1;
+        }
+
+        std::cout << "Densidad de páginas cargadas para promover una región (default "
+                  << DEFAULT_PROMOTION_DENSITY << "): ";
+        std::getline(std::cin, input);
+        if (!input.empty())
+            densidad = std::stod(input);
+        if (!(densidad > 0.0 && densidad <= 1.0))
+        {
+            std::cerr << "Error: la densidad debe estar en (0, 1].\n";
+            return 1;
+        }
+    }
+
     // Procesar entradas
     if (marcoCount == 0)
         marcoCount = DEFAULT_FRAME_COUNT;
 
-    ReplacementAlgorithm algoritmo = parseAlgorithm(algoritmoStr);
-    PageReplacementSimulator sim(marcoCount, algoritmo);
+    // El barrido y la estimación por muestreo recorren un rango de marcos con una lista de
+    // algoritmos; el streaming y el prefetch, solo la lista (OPT queda afuera porque necesita
+    // conocer la traza completa)
+    int marcoMin = 1;
+    int marcoMax = marcoCount;
+    std::vector<ReplacementAlgorithm> listaAlgoritmos;
+    for (ReplacementAlgorithm alg : REPLACEMENT_ALGORITHMS)
+    {
+        if ((algoritmo != ReplacementAlgorithm::Stream && algoritmo != ReplacementAlgorithm::Prefetch) ||
+            alg != ReplacementAlgorithm::OPT)
+            listaAlgoritmos.push_back(alg);
+    }
 
-    // Cargar estado inicial si se indicó
-    if (estadoInicialStr != "0")
+    if (algoritmo == ReplacementAlgorithm::Sweep || algoritmo == ReplacementAlgorithm::Shards)
+    {
+        std::cout << "Rango de marcos min-max (default 1-" << marcoCount << "): ";
+        std::getline(std::cin, input);
+        if (!input.empty())
+        {
+            size_t guion = input.find('-');
+            marcoMin = std::stoi(input.substr(0, guion));
+            marcoMax = (guion == std::string::npos) ? marcoMin : std::stoi(input.substr(guion + 1));
+        }
+        if (marcoMin < 1 || marcoMax < marcoMin)
+        {
+            std::cerr << "Error: rango de marcos inválido: " << marcoMin << "-" << marcoMax << std::endl;
+            return 1;
+        }
+    }
+
+    if (algoritmo == ReplacementAlgorithm::Sweep || algoritmo == ReplacementAlgorithm::Stream ||
+        algoritmo == ReplacementAlgorithm::Shards || algoritmo == ReplacementAlgorithm::Prefetch)
     {
-        std::vector<int> estadoInicial;
-        std::vector<bool> dummyMods;
-        parseAccessSequence(estadoInicialStr, estadoInicial, dummyMods);
+        std::cout << "Algoritmos separados por coma (default todos): ";
+        std::getline(std::cin, input);
+        if (!input.empty() && !leerAlgoritmos(input, listaAlgoritmos))
+            return 1;
+    }
+
+    // SHARDS simula solo una fracción de las páginas; opcionalmente se valida contra el barrido exacto
+    double tasaMuestreo = DEFAULT_SAMPLING_RATE;
+    bool validarExacto = false;
+    if (algoritmo == ReplacementAlgorithm::Shards)
+    {
+        std::cout << "Tasa de muestreo de páginas (default " << DEFAULT_SAMPLING_RATE << "): ";
+        std::getline(std::cin, input);
+        if (!input.empty())
+            tasaMuestreo = std::stod(input);
+        if (!(tasaMuestreo > 0.0 && tasaMuestreo <= 1.0))
+        {
+            std::cerr << "Error: la tasa de muestreo debe estar en (0, 1].\n";
+            return 1;
+        }
+
+        std::cout << "¿Comparar con la simulación exacta? s/n (default n): ";
+        std::getline(std::cin, input);
+        validarExacto = !input.empty() && (input[0] == 's' || input[0] == 'S');
+    }
+
+    // Páginas que el predictor propone en cada disparo del prefetch
+    int gradoPrefetch = DEFAULT_PREFETCH_DEGREE;
+    if (algoritmo == ReplacementAlgorithm::Prefetch)
+    {
+        std::cout << "Páginas por disparo del prefetch (default " << DEFAULT_PREFETCH_DEGREE << "): ";
+        std::getline(std::cin, input);
+        if (!input.empty())
+            gradoPrefetch = std::stoi(input);
+        if (gradoPrefetch < 1)
+        {
+            std::cerr << "Error: el prefetch necesita al menos una página por disparo.\n";
+            return 1;
+        }
+        if (std::find(listaAlgoritmos.begin(), listaAlgoritmos.end(), ReplacementAlgorithm::OPT) !=
+            listaAlgoritmos.end())
+        {
+            std::cerr << "Error: OPT necesita la traza completa y no puede ejecutarse con prefetch.\n";
+            return 1;
+        }
+    }
+
+    // Niveles de memoria: política de la DRAM y niveles bajo ella (el disco es el último)
+    MemoryTier dram;
+    std::vector<MemoryTier> niveles;
+    if (algoritmo == ReplacementAlgorithm::Tiered)
+    {
+        std::cout << "Algoritmo de la DRAM (default LRU): ";
+        std::getline(std::cin, input);
+        dram.frames = marcoCount;
+        dram.latency = MEMORY_ACCESS_US;
+        if (!input.empty())
+            dram.algorithm = parseAlgorithm(input);
+        if (std::find(std::begin(REPLACEMENT_ALGORITHMS), std::end(REPLACEMENT_ALGORITHMS), dram.algorithm) ==
+                std::end(REPLACEMENT_ALGORITHMS) ||
+            dram.algorithm == ReplacementAlgorithm::OPT)
+        {
+            std::cerr << "Error: la DRAM necesita un algoritmo de reemplazo distinto de OPT.\n";
+            return 1;
+        }
 
-        for (size_t i = 0; i < estadoInicial.size() && i < static_cast<size_t>(marcoCount); ++i) {
-            int page = estadoInicial[i];
-            sim.memory[i].pageNumber = page;
-            sim.memory[i].bits = {true, false, true};  // R=1, M=0, V=1
-            sim.memory[i].frequency = sim.globalFrequencies[page] = 1;
+        std::ostringstream porDefecto;
+        porDefecto << marcoCount << ":LRU:" << DEFAULT_COMPRESSED_US;
+        std::cout << "Niveles bajo la DRAM como marcos:algoritmo:latencia µs separados por ';' (default "
+                  << porDefecto.str() << "): ";
+        std::getline(std::cin, input);
+        if (!parseTiers(input.empty() ? porDefecto.str() : input, niveles))
+            return 1;
+    }
+
+    if (algoritmo == ReplacementAlgorithm::Stream)
+    {
+        if (std::find(listaAlgoritmos.begin(), listaAlgoritmos.end(), ReplacementAlgorithm::OPT) !=
+            listaAlgoritmos.end())
+        {
+            std::cerr << "Error: OPT necesita la traza completa y no puede ejecutarse en streaming.\n";
+            return 1;
+        }
+        if (accesoStr.empty() || accesoStr[0] != '@')
+        {
+            std::cerr << "Error: el modo Stream lee la traza de un archivo: use @ruta, o @- para la entrada estándar.\n";
+            return 1;
         }
     }
 
-    // Parsear la secuencia de accesos
-    std::vector<int> paginas;
-    std::vector<bool> modificadas;
-    parseAccessSequence(accesoStr, paginas, modificadas);
+    PageReplacementSimulator sim(marcoCount, algoritmo);
+    sim.timerInterval = intervalo;
+    sim.agingBits = bitsAging;
+    sim.workingSetWindow = ventana;
+    sim.readFaultLatency = latenciaLectura;
+    sim.writebackLatency = latenciaEscritura;
+
+    // Cargar estado inicial si se indicó (se parsea una sola vez para todos los modos)
+    AccessTrace estadoInicial;
+    if (estadoInicialStr != "0")
+        parseAccessSequence(estadoInicialStr, estadoInicial);
+    loadInitialState(sim, estadoInicial);
+    if (!checkpointEntrada.empty() && !restoreCheckpoint(sim, checkpointEntrada))
+        return 1;
+
+    // Parsear la secuencia de accesos ("@ruta" la lee de un archivo de texto o binario).
+    // En streaming la traza nunca se carga completa: se lee por bloques al simular.
+    // Con varios procesos, cada acceso lleva su proceso ("1:5*").
+    AccessTrace traza;
+    ProcessTrace trazaProcesos;
+    if (algoritmo == ReplacementAlgorithm::MultiProcess)
+    {
+        if (!accesoStr.empty() && accesoStr[0] == '@')
+            loadProcessTrace(accesoStr.substr(1), trazaProcesos);
+        else
+            parseProcessTrace(accesoStr, trazaProcesos);
+    }
+    else if (algoritmo != ReplacementAlgorithm::Stream)
+    {
+        if (!accesoStr.empty() && accesoStr[0] == '@')
+            loadAccessTrace(accesoStr.substr(1), traza, desplazamientoPagina);
+        else
+            parseAccessSequence(accesoStr, traza);
+    }
 
     // Ejecutar el algoritmo correspondiente
-    if (algoritmo == ReplacementAlgorithm::FIFO)
-        runFIFO(sim, paginas, modificadas);
-    else if (algoritmo == ReplacementAlgorithm::SecondChance)
-        runSecondChance(sim, paginas, modificadas);
-    else if (algoritmo == ReplacementAlgorithm::NRU)
-        runNRU(sim, paginas, modificadas);
-    else if (algoritmo == ReplacementAlgorithm::LRU)
-        runLRU(sim, paginas, modificadas);
-    else if (algoritmo == ReplacementAlgorithm::Clock)
-        runClock(sim, paginas, modificadas);
-    else if (algoritmo == ReplacementAlgorithm::LFU)
-        runLFU(sim, paginas, modificadas);
-    else if (algoritmo == ReplacementAlgorithm::MFU)
-        runMFU(sim, paginas, modificadas);
-    else if (algoritmo == ReplacementAlgorithm::All) {  // Modo ranking
-        std::vector<std::pair<std::string, int>> resultados;
-
-        for (ReplacementAlgorithm alg : {
-            ReplacementAlgorithm::FIFO,
-            ReplacementAlgorithm::SecondChance,
-            ReplacementAlgorithm::NRU,
-            ReplacementAlgorithm::LRU,
-            ReplacementAlgorithm::Clock,
-            ReplacementAlgorithm::LFU,
-            ReplacementAlgorithm::MFU
-        }) {
+    std::vector<TranslationBuffer> tlbs;
+    std::unique_ptr<Timeline> serie;
+    if (algoritmo == ReplacementAlgorithm::All) {  // Modo ranking
+        std::vector<ResultadoRanking> resultados;
+
+        for (ReplacementAlgorithm alg : REPLACEMENT_ALGORITHMS) {
             PageReplacementSimulator simTmp(marcoCount, alg);
+            simTmp.timerInterval = intervalo;
+            simTmp.workingSetWindow = ventana;
+            simTmp.readFaultLatency = latenciaLectura;
+            simTmp.writebackLatency = latenciaEscritura;
+            loadInitialState(simTmp, estadoInicial);
 
-            // Cargar estado inicial si se indicó
-            if (estadoInicialStr != "0") {
-                std::vector<int> estadoInicial;
-                std::vector<bool> dummyMods;
-                parseAccessSequence(estadoInicialStr, estadoInicial, dummyMods);
-
-                for (size_t i = 0; i < estadoInicial.size() && i < static_cast<size_t>(marcoCount); ++i) {
-                    int page = estadoInicial[i];
-                    simTmp.memory[i].pageNumber = page;
-                    simTmp.memory[i].bits = {true, false, true};  // R=1, M=0, V=1
-                    simTmp.memory[i].frequency = simTmp.globalFrequencies[page] = 1;
-                }
-            }
+            runAlgorithm(simTmp, traza);
+            resultados.push_back(resultadoDe(simTmp, traza.size()));
+        }
+
+        imprimirRanking(resultados);
+    } else if (algoritmo == ReplacementAlgorithm::MRC) {  // Curva de fallos en una pasada
+        printMissRatioCurve(computeLRUMissRatioCurve(traza), traza.size());
+    } else if (algoritmo == ReplacementAlgorithm::WorkingSet) {  // Conjunto de trabajo en el tiempo
+        printWorkingSet(computeWorkingSet(traza, ventana), traza.size());
+    } else if (algoritmo == ReplacementAlgorithm::Sweep) {  // Matriz de fallos en paralelo
+        printSweep(runSweep(traza, estadoInicial, marcoMin, marcoMax, listaAlgoritmos, sim));
+    } else if (algoritmo == ReplacementAlgorithm::Shards) {  // Curvas estimadas por muestreo
+        ShardsResult estimacion = runShards(traza, marcoMin, marcoMax, listaAlgoritmos, tasaMuestreo, sim);
+        if (validarExacto) {
+            SweepResult exacto = runSweep(traza, AccessTrace(), marcoMin, marcoMax, listaAlgoritmos, sim);
+            printShards(estimacion, traza.size(), &exacto);
+        } else {
+            printShards(estimacion, traza.size());
+        }
+    } else if (algoritmo == ReplacementAlgorithm::Stream) {  // Varios algoritmos a la vez, por bloques
+        std::vector<PageReplacementSimulator> simuladores;
+        for (ReplacementAlgorithm alg : listaAlgoritmos) {
+            simuladores.emplace_back(marcoCount, alg);
+            simuladores.back().timerInterval = intervalo;
+            simuladores.back().workingSetWindow = ventana;
+            simuladores.back().readFaultLatency = latenciaLectura;
+            simuladores.back().writebackLatency = latenciaEscritura;
+            loadInitialState(simuladores.back(), estadoInicial);
+        }
+
+        size_t accesos = runStreaming(accesoStr.substr(1), simuladores, desplazamientoPagina);
 
-            // Ejecutar el algoritmo
-            if (alg == ReplacementAlgorithm::FIFO)
-                runFIFO(simTmp, paginas, modificadas);
-            else if (alg == ReplacementAlgorithm::SecondChance)
-                runSecondChance(simTmp, paginas, modificadas);
-            else if (alg == ReplacementAlgorithm::NRU)
-                runNRU(simTmp, paginas, modificadas);
-            else if (alg == ReplacementAlgorithm::LRU)
-                runLRU(simTmp, paginas, modificadas);
-            else if (alg == ReplacementAlgorithm::Clock)
-                runClock(simTmp, paginas, modificadas);
-            else if (alg == ReplacementAlgorithm::LFU)
-                runLFU(simTmp, paginas, modificadas);
-            else if (alg == ReplacementAlgorithm::MFU)
-                runMFU(simTmp, paginas, modificadas);
-
-            resultados.emplace_back(to_string(alg), simTmp.pageFaults);
-        }
-
-        // Ordenar ranking por número de fallos (ascendente)
-        std::sort(resultados.begin(), resultados.end(), [](auto &a, auto &b) {
-            return a.second < b.second;
-        });
-
-        std::cout << "\n=== Ranking de algoritmos (menor a mayor cantidad de fallos) ===\n";
-        for (size_t i = 0; i < resultados.size(); ++i) {
-            std::cout << i + 1 << ". " << resultados[i].first << ": " << resultados[i].second << " fallos\n";
-        }
-    } else {
+        std::vector<ResultadoRanking> resultados;
+        for (const auto &simulador : simuladores)
+            resultados.push_back(resultadoDe(simulador, accesos));
+        std::cout << "\nAccesos procesados: " << accesos << "\n";
+        imprimirRanking(resultados);
+    } else if (algoritmo == ReplacementAlgorithm::MultiProcess) {  // Asignación de marcos entre procesos
+        std::vector<MultiProcessResult> resultados;
+        for (FrameAllocation asignacion : {FrameAllocation::Global, FrameAllocation::LocalFixed, FrameAllocation::PFF})
+            resultados.push_back(runMultiProcess(trazaProcesos, marcoCount, asignacion, ventanaFallos));
+        printMultiProcess(resultados, marcoCount, ventanaFallos, trazaProcesos.accesses.size());
+    } else if (algoritmo == ReplacementAlgorithm::HugePages) {  // Páginas base y grandes
+        std::vector<HugePageResult> resultados;
+        for (const auto &politica : makeHugePagePolicies(densidad))
+            resultados.push_back(runHugePages(traza, marcoCount, desplazamientoPagina, desplazamientoGrande, *politica, tlb));
+        printHugePages(resultados, marcoCount, desplazamientoPagina, desplazamientoGrande, tlb, traza.size());
+    } else if (algoritmo == ReplacementAlgorithm::Prefetch) {  // Con y sin precarga por predictor
+        printPrefetch(runPrefetch(traza, estadoInicial, marcoCount, listaAlgoritmos, gradoPrefetch, sim), traza.size());
+    } else if (algoritmo == ReplacementAlgorithm::Tiered) {  // DRAM, niveles intermedios y disco
+        printTiered(runTiered(traza, estadoInicial, dram, niveles, sim),
+                    sizeFirstTier(traza, estadoInicial, dram, niveles, sim));
+    } else if (usarTlb) {  // Un algoritmo con la traducción delante
+        // Un TLB por tamaño de página: el de la traza y las páginas grandes de 2 MiB y 1 GiB
+        tlbs.emplace_back(tlb, desplazamientoPagina, desplazamientoPagina);
+        for (int grande : {21, 30}) {
+            if (grande > desplazamientoPagina)
+                tlbs.emplace_back(tlb, grande, desplazamientoPagina);
+        }
+        runTranslated(sim, traza, tlbs);
+    } else if (ventanaSerie > 0) {  // Un algoritmo con su serie temporal por ventanas
+        serie = std::make_unique<Timeline>(algoritmo, marcoCount, ventanaSerie, DEFAULT_TIMELINE_CAPACITY);
+        recordTimeline(sim, traza, *serie);
+    } else if (!runAlgorithm(sim, traza)) {
         std::cerr << "Error: Algoritmo no implementado todavía.\n";
         return 1;
     }
 
     // Mostrar resultados
-    if (algoritmo != ReplacementAlgorithm::All) {
+    if (algoritmo != ReplacementAlgorithm::All && algoritmo != ReplacementAlgorithm::MRC &&
+        algoritmo != ReplacementAlgorithm::WorkingSet && algoritmo != ReplacementAlgorithm::Sweep &&
+        algoritmo != ReplacementAlgorithm::Stream && algoritmo != ReplacementAlgorithm::Shards &&
+        algoritmo != ReplacementAlgorithm::MultiProcess && algoritmo != ReplacementAlgorithm::HugePages &&
+        algoritmo != ReplacementAlgorithm::Prefetch && algoritmo != ReplacementAlgorithm::Tiered) {
         std::cout << "\nCantidad de fallos de página: " << sim.pageFaults << "\n";
+        if (sim.metadataBytes > 0)
+            std::cout << "Metadatos de reemplazo: " << static_cast<double>(sim.metadataBytes) / marcoCount
+                      << " bytes/marco\n";
+        printCost(sim.cleanEvictions, sim.dirtyEvictions, effectiveAccessTime(sim, sim.accessCount),
+                  ioVolumeBytes(sim), "");
+        if (usarTlb) {
+            std::vector<TlbStats> traduccion;
+            for (const auto &buffer : tlbs)
+                traduccion.push_back(buffer.stats());
+            printTlb(traduccion, tlb);
+        }
         printMemory(sim.memory);
+        if (!checkpointSalida.empty()) {
+            if (!saveCheckpoint(sim, checkpointSalida)) {
+                std::cerr << "Error: no se pudo escribir el checkpoint en " << checkpointSalida << std::endl;
+                return 1;
+            }
+            std::cout << "Checkpoint guardado en " << checkpointSalida << " (" << sim.accessCount << " accesos)\n";
+        }
+        if (serie) {
+            printTimeline(*serie, archivoSerie.empty());
+            if (!archivoSerie.empty()) {
+                if (!writeTimeline(*serie, archivoSerie)) {
+                    std::cerr << "Error: no se pudo escribir la serie en " << archivoSerie << std::endl;
+                    return 1;
+                }
+                std::cout << "Serie guardada en " << archivoSerie << "\n";
+            }
+        }
     }
 
     return 0;